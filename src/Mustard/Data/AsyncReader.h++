@@ -18,10 +18,13 @@
 
 #pragma once
 
+#include "Mustard/Data/ColumnBatch.h++"
+#include "Mustard/Data/RDFDataset.h++"
 #include "Mustard/Data/RDFEventSplit.h++"
 #include "Mustard/Data/Tuple.h++"
 #include "Mustard/Data/TupleModel.h++"
 #include "Mustard/Data/internal/ReadHelper.h++"
+#include "Mustard/Data/internal/TupleArena.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Utility/NonCopyableBase.h++"
 #include "Mustard/gslx/index_sequence.h++"
@@ -30,6 +33,7 @@
 #include "RtypesCore.h"
 #include "TROOT.h"
 
+#include "muc/chrono"
 #include "muc/concepts"
 #include "muc/ptrvec"
 #include "muc/utility"
@@ -38,13 +42,16 @@
 
 #include "fmt/core.h"
 
+#include <algorithm>
 #include <atomic>
 #include <concepts>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <future>
+#include <mutex>
 #include <optional>
-#include <semaphore>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -57,46 +64,99 @@
 
 namespace Mustard::Data {
 
+/// @brief Reads batches of data in background thread(s).
+/// Batches are queued by Read() and taken by Acquire() in the same order.
+/// Several batches can be queued ahead, so that reading runs ahead of
+/// processing by as many batches as the caller keeps queued.
 template<typename AData>
 class AsyncReader : public NonCopyableBase {
 public:
     using DataType = AData;
 
 public:
+    /// @brief Read all batches in a single event loop over rdf, in one thread.
     AsyncReader(gsl::index sentinel, std::function<void(ROOT::RDF::RNode)> ReadLoop, ROOT::RDF::RNode rdf);
+    /// @brief Read each batch independently by ReadRange. With nDecoder > 1,
+    /// queued batches are read concurrently by nDecoder threads.
+    AsyncReader(gsl::index sentinel, std::function<AData(gsl::index, gsl::index)> ReadRange, int nDecoder = 1);
     virtual ~AsyncReader() = 0;
 
     virtual auto Read(gsl::index first, gsl::index last) -> void;
     [[nodiscard]] virtual auto Acquire() -> AData;
     virtual auto Exhaust() -> void;
 
-    auto Reading() const -> auto { return fReading; }
+    auto Reading() const -> auto { return fNQueued > 0; }
+    auto NQueued() const -> auto { return fNQueued; }
     auto Exhausted() const -> auto { return fExhausted.load(); }
+    /// @brief Accumulated time Acquire() has been blocked waiting for data.
+    auto AcquireWaitTime() const -> auto { return fAcquireWaitTime; }
 
 protected:
     auto First() const -> auto { return fFirst; };
     auto Last() const -> auto { return fLast; };
+    /// @brief True once the reader has been stopped or exhausted, so that the
+    /// rest of the event loop can be skipped.
+    auto Skipping() const -> auto { return fFirst == fSentinel; }
     auto CompleteRead() -> void;
+    /// @brief Stop and join reader thread(s). Derived readers whose read
+    /// functions touch their own members must call this in their destructor.
+    auto Stop() -> void;
+    auto EntryFilter() -> auto;
 
 protected:
     AData fData;
 
+private:
+    struct Batch {
+        gsl::index first;
+        gsl::index last;
+        AData data;
+        bool complete;
+    };
+
+private:
+    auto NextBatch() -> void;
+
 private:
     gsl::index fFirst;
     gsl::index fLast;
+    Batch* fCurrentBatch;
 
     gsl::index fSentinel;
-    std::jthread fReaderThread;
-    std::binary_semaphore fStartReadSemaphore;
-    std::binary_semaphore fCompleteReadSemaphore;
+    std::deque<Batch> fBatchQueue;
+    gsl::index fNDispatched;
+    gsl::index fNQueued;
+    bool fStop;
+    std::mutex fMutex;
+    std::condition_variable fBatchQueued;
+    std::condition_variable fBatchComplete;
     std::atomic_bool fExhausted;
-    bool fReading;
+    muc::chrono::seconds<double> fAcquireWaitTime;
+    std::vector<std::jthread> fReaderThread;
 };
 
 template<TupleModelizable... Ts>
 class AsyncEntryReader : public AsyncReader<muc::shared_ptrvec<Tuple<Ts...>>> {
 public:
     AsyncEntryReader(ROOT::RDF::RNode dataFrame);
+    AsyncEntryReader(RDFDataset dataset, int nDecoder = 1);
+    ~AsyncEntryReader();
+
+private:
+    static auto EntryFiller(muc::shared_ptrvec<Tuple<Ts...>>& data, internal::TupleArena& arena) -> auto;
+
+private:
+    internal::TupleArena fArena;
+};
+
+template<TupleModelizable... Ts>
+class AsyncColumnReader : public AsyncReader<ColumnBatch<Ts...>> {
+public:
+    AsyncColumnReader(ROOT::RDF::RNode dataFrame);
+    AsyncColumnReader(RDFDataset dataset, int nDecoder = 1);
+
+private:
+    static auto ColumnFiller(ColumnBatch<Ts...>& data) -> auto;
 };
 
 template<std::integral AEventIDType, muc::instantiated_from<TupleModel>... Ts>
@@ -115,11 +175,15 @@ class AsyncEventReader<AEventIDType, TupleModel<Ts...>> : public AsyncReader<std
 public:
     AsyncEventReader(ROOT::RDF::RNode dataFrame, std::string eventIDColumnName);
     AsyncEventReader(ROOT::RDF::RNode dataFrame, std::vector<gsl::index> eventSplit);
+    AsyncEventReader(RDFDataset dataset, std::string eventIDColumnName, int nDecoder = 1);
+    AsyncEventReader(RDFDataset dataset, std::vector<gsl::index> eventSplit, int nDecoder = 1);
+    ~AsyncEventReader();
 
     virtual auto Read(gsl::index first, gsl::index last) -> void override;
 
 private:
     std::vector<gsl::index> fEventSplit;
+    internal::TupleArena fArena;
 };
 
 } // namespace Mustard::Data
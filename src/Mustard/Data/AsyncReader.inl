@@ -24,44 +24,116 @@ AsyncReader<AData>::AsyncReader(gsl::index sentinel, std::function<void(ROOT::RD
     fData{},
     fFirst{},
     fLast{},
+    fCurrentBatch{},
     fSentinel{sentinel},
-    fReaderThread{},
-    fStartReadSemaphore{0},
-    fCompleteReadSemaphore{0},
+    fBatchQueue{},
+    fNDispatched{},
+    fNQueued{},
+    fStop{},
+    fMutex{},
+    fBatchQueued{},
+    fBatchComplete{},
     fExhausted{},
-    fReading{} {
+    fAcquireWaitTime{},
+    fReaderThread{} {
     if (ROOT::IsImplicitMTEnabled()) {
         Throw<std::logic_error>("Async RDataFrame reader cannot be used with IMT enabled");
     }
-    fReaderThread = std::jthread{
+    if (fSentinel == 0) {
+        fExhausted = true;
+        return;
+    }
+    fReaderThread.emplace_back(
         [this](std::function<void(ROOT::RDF::RNode)> ReadLoop, ROOT::RDF::RNode rdf) {
-            if (fSentinel == 0) {
+            NextBatch();
+            std::invoke(std::move(ReadLoop), std::move(rdf));
+            {
+                const std::scoped_lock lock{fMutex};
                 fExhausted = true;
-                return;
+                if (fCurrentBatch) {
+                    fCurrentBatch->data = std::move(fData);
+                    fCurrentBatch->complete = true;
+                }
             }
-            fStartReadSemaphore.acquire();
-            std::invoke(std::move(ReadLoop), std::move(rdf));
-            fExhausted = true;
-            fCompleteReadSemaphore.release();
+            fBatchComplete.notify_one();
         },
-        std::move(ReadLoop), std::move(rdf)};
+        std::move(ReadLoop), std::move(rdf));
+}
+
+template<typename AData>
+AsyncReader<AData>::AsyncReader(gsl::index sentinel, std::function<AData(gsl::index, gsl::index)> ReadRange, int nDecoder) :
+    NonCopyableBase{},
+    fData{},
+    fFirst{},
+    fLast{},
+    fCurrentBatch{},
+    fSentinel{sentinel},
+    fBatchQueue{},
+    fNDispatched{},
+    fNQueued{},
+    fStop{},
+    fMutex{},
+    fBatchQueued{},
+    fBatchComplete{},
+    fExhausted{},
+    fAcquireWaitTime{},
+    fReaderThread{} {
+    if (ROOT::IsImplicitMTEnabled()) {
+        Throw<std::logic_error>("Async RDataFrame reader cannot be used with IMT enabled");
+    }
+    if (fSentinel == 0) {
+        fExhausted = true;
+        return;
+    }
+    nDecoder = std::max(1, nDecoder);
+    if (nDecoder > 1) {
+        ROOT::EnableThreadSafety();
+    }
+    const auto Decode{[this](const std::function<AData(gsl::index, gsl::index)>& ReadRange) {
+        while (true) {
+            std::unique_lock lock{fMutex};
+            fBatchQueued.wait(lock, [this] { return fStop or fNDispatched < ssize(fBatchQueue); });
+            if (fStop) {
+                return;
+            }
+            auto& batch{fBatchQueue[fNDispatched++]};
+            if (batch.first == fSentinel) {
+                fExhausted = true;
+                fStop = true;
+                batch.complete = true;
+                lock.unlock();
+                fBatchQueued.notify_all();
+                fBatchComplete.notify_one();
+                return;
+            }
+            lock.unlock();
+            auto data{batch.first == batch.last ? AData{} : std::invoke(ReadRange, batch.first, batch.last)};
+            lock.lock();
+            batch.data = std::move(data);
+            batch.complete = true;
+            lock.unlock();
+            fBatchComplete.notify_one();
+        }
+    }};
+    fReaderThread.reserve(nDecoder);
+    for (int i{}; i < nDecoder; ++i) {
+        fReaderThread.emplace_back(Decode, ReadRange);
+    }
 }
 
 template<typename AData>
 AsyncReader<AData>::~AsyncReader() {
-    if (fReading) {
+    if (fNQueued > 0) {
         Throw<std::logic_error>("Last read data not acquired");
     }
     if (not fExhausted) {
         PrintWarning("Data have not been exhausted");
     }
+    Stop();
 }
 
 template<typename AData>
 auto AsyncReader<AData>::Read(gsl::index first, gsl::index last) -> void {
-    if (fReading) {
-        Throw<std::logic_error>("Try to start another read while reading");
-    }
     if (fExhausted) {
         Throw<std::logic_error>("Data have been exhausted");
     }
@@ -74,21 +146,29 @@ auto AsyncReader<AData>::Read(gsl::index first, gsl::index last) -> void {
     if (first > last) {
         Throw<std::out_of_range>("first > last");
     }
-    fFirst = first;
-    fLast = last;
-    fData.reserve(last - first);
-    fReading = true;
-    fStartReadSemaphore.release();
+    {
+        const std::scoped_lock lock{fMutex};
+        fBatchQueue.push_back({first, last, {}, false});
+    }
+    ++fNQueued;
+    fBatchQueued.notify_one();
 }
 
 template<typename AData>
 [[nodiscard]] auto AsyncReader<AData>::Acquire() -> AData {
-    if (not fReading) {
+    if (fNQueued == 0) {
         Throw<std::logic_error>("Try to acquire result while not reading");
     }
-    fCompleteReadSemaphore.acquire();
-    fReading = false;
-    return std::move(fData);
+    muc::chrono::stopwatch stopwatch;
+    std::unique_lock lock{fMutex};
+    fBatchComplete.wait(lock, [this] { return fBatchQueue.front().complete; });
+    auto data{std::move(fBatchQueue.front().data)};
+    fBatchQueue.pop_front();
+    --fNDispatched;
+    lock.unlock();
+    --fNQueued;
+    fAcquireWaitTime += stopwatch.read();
+    return data;
 }
 
 template<typename AData>
@@ -99,9 +179,62 @@ auto AsyncReader<AData>::Exhaust() -> void {
 
 template<typename AData>
 auto AsyncReader<AData>::CompleteRead() -> void {
-    fCompleteReadSemaphore.release();
-    fStartReadSemaphore.acquire();
+    {
+        const std::scoped_lock lock{fMutex};
+        fCurrentBatch->data = std::move(fData);
+        fCurrentBatch->complete = true;
+    }
+    fBatchComplete.notify_one();
+    NextBatch();
+}
+
+template<typename AData>
+auto AsyncReader<AData>::Stop() -> void {
+    {
+        const std::scoped_lock lock{fMutex};
+        fStop = true;
+    }
+    fBatchQueued.notify_all();
+    fReaderThread.clear(); // join
+}
+
+template<typename AData>
+auto AsyncReader<AData>::NextBatch() -> void {
+    std::unique_lock lock{fMutex};
+    fBatchQueued.wait(lock, [this] { return fStop or fNDispatched < ssize(fBatchQueue); });
+    if (fStop) {
+        // skip the rest of the event loop
+        fCurrentBatch = nullptr;
+        fFirst = fSentinel;
+        fLast = fSentinel;
+        return;
+    }
+    fCurrentBatch = &fBatchQueue[fNDispatched++];
+    fFirst = fCurrentBatch->first;
+    fLast = fCurrentBatch->last;
+    lock.unlock();
     fData.clear();
+    fData.reserve(fLast - fFirst);
+}
+
+template<typename AData>
+auto AsyncReader<AData>::EntryFilter() -> auto {
+    return [this](ULong64_t uEntry) {
+        if (Skipping()) {
+            return false;
+        }
+        const auto entry{muc::to_signed(uEntry)};
+        while (entry == fLast) {
+            CompleteRead();
+            if (entry > fFirst) [[unlikely]] {
+                Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, fFirst));
+            }
+        }
+        if (entry < fFirst) {
+            return false;
+        }
+        return true;
+    };
 }
 
 template<TupleModelizable... Ts>
@@ -109,31 +242,82 @@ AsyncEntryReader<Ts...>::AsyncEntryReader(ROOT::RDF::RNode rdf) :
     AsyncReader<muc::shared_ptrvec<Tuple<Ts...>>>{
         *rdf.Count(),
         [this](ROOT::RDF::RNode rdf) {
-            rdf.Filter([this](ULong64_t uEntry) {
-                   const auto entry{muc::to_signed(uEntry)};
-                   if (entry == this->Last()) {
-                       this->CompleteRead();
-                       if (entry > this->First()) [[unlikely]] {
-                           Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, this->First()));
-                       }
-                   }
-                   if (entry < this->First()) {
+            rdf.Filter([this, Filter = this->EntryFilter()](ULong64_t entry) {
+                   if (not Filter(entry)) {
                        return false;
                    }
+                   if (this->fData.empty()) {
+                       fArena.template Reset<Tuple<Ts...>>(this->Last() - this->First());
+                   }
                    return true;
                },
                        {"rdfentry_"})
-                .Foreach([this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
-                    return [this](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
-                        this->fData.emplace_back(std::make_shared<Tuple<Ts...>>(
-                            internal::ReadHelper<Ts...>::template As<
-                                typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
-                    };
-                }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
-                         Tuple<Ts...>::NameVector());
+                .Foreach(EntryFiller(this->fData, fArena), Tuple<Ts...>::NameVector());
+        },
+        rdf} {}
+
+template<TupleModelizable... Ts>
+AsyncEntryReader<Ts...>::AsyncEntryReader(RDFDataset dataset, int nDecoder) :
+    AsyncReader<muc::shared_ptrvec<Tuple<Ts...>>>{
+        dataset.NEntry(),
+        [dataset](gsl::index first, gsl::index last) {
+            muc::shared_ptrvec<Tuple<Ts...>> data;
+            data.reserve(last - first);
+            internal::TupleArena arena;
+            arena.template Reset<Tuple<Ts...>>(last - first);
+            dataset.DataFrame({first, last}).Foreach(EntryFiller(data, arena), Tuple<Ts...>::NameVector());
+            return data;
+        },
+        nDecoder} {}
+
+template<TupleModelizable... Ts>
+AsyncEntryReader<Ts...>::~AsyncEntryReader() {
+    this->Stop();
+}
+
+template<TupleModelizable... Ts>
+auto AsyncEntryReader<Ts...>::EntryFiller(muc::shared_ptrvec<Tuple<Ts...>>& data, internal::TupleArena& arena) -> auto {
+    return [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return [&data, &arena](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
+            data.emplace_back(arena.template MakeShared<Tuple<Ts...>>(
+                internal::ReadHelper<Ts...>::template As<
+                    typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+        };
+    }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{});
+}
+
+template<TupleModelizable... Ts>
+AsyncColumnReader<Ts...>::AsyncColumnReader(ROOT::RDF::RNode rdf) :
+    AsyncReader<ColumnBatch<Ts...>>{
+        *rdf.Count(),
+        [this](ROOT::RDF::RNode rdf) {
+            rdf.Filter(this->EntryFilter(), {"rdfentry_"})
+                .Foreach(ColumnFiller(this->fData), ColumnBatch<Ts...>::NameVector());
         },
         rdf} {}
 
+template<TupleModelizable... Ts>
+AsyncColumnReader<Ts...>::AsyncColumnReader(RDFDataset dataset, int nDecoder) :
+    AsyncReader<ColumnBatch<Ts...>>{
+        dataset.NEntry(),
+        [dataset](gsl::index first, gsl::index last) {
+            ColumnBatch<Ts...> data;
+            data.reserve(last - first);
+            dataset.DataFrame({first, last}).Foreach(ColumnFiller(data), ColumnBatch<Ts...>::NameVector());
+            return data;
+        },
+        nDecoder} {}
+
+template<TupleModelizable... Ts>
+auto AsyncColumnReader<Ts...>::ColumnFiller(ColumnBatch<Ts...>& data) -> auto {
+    return [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return [&data](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
+            data.emplace_back(internal::ReadHelper<Ts...>::template As<
+                                     typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...);
+        };
+    }(gslx::make_index_sequence<ColumnBatch<Ts...>::NColumn()>{});
+}
+
 // template<std::integral AEventIDType, muc::instantiated_from<TupleModel>... Ts>
 // AsyncEventReader<AEventIDType, Ts...>::AsyncEventReader(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf, std::string eventIDColumnName) :
 //     AsyncEventReader{rdf, RDFEventSplit<AEventIDType>(rdf, std::move(eventIDColumnName))} {}
@@ -160,8 +344,11 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
             const auto& es{fEventSplit};
             auto nextEvent{this->First()};
             rdf.Filter([&](ULong64_t uEntry) {
+                   if (this->Skipping()) {
+                       return false;
+                   }
                    const auto entry{muc::to_signed(uEntry)};
-                   if (entry == es[this->Last()]) {
+                   while (entry == es[this->Last()]) {
                        this->CompleteRead();
                        if (entry > es[this->First()]) {
                            Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, es[this->First()]));
@@ -172,6 +359,9 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
                        return false;
                    }
                    if (entry == es[nextEvent]) {
+                       if (this->fData.empty()) {
+                           fArena.template Reset<Tuple<Ts...>>(es[this->Last()] - es[this->First()]);
+                       }
                        this->fData.emplace_back().reserve(es[nextEvent + 1] - es[nextEvent]);
                        ++nextEvent;
                    }
@@ -180,7 +370,7 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
                        {"rdfentry_"})
                 .Foreach([this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
                     return [this](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
-                        this->fData.back().emplace_back(std::make_shared<Tuple<Ts...>>(
+                        this->fData.back().emplace_back(fArena.template MakeShared<Tuple<Ts...>>(
                             internal::ReadHelper<Ts...>::template As<
                                 typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
                     };
@@ -194,6 +384,50 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
     Expects(std::ranges::is_sorted(fEventSplit));
 }
 
+template<std::integral AEventIDType, TupleModelizable... Ts>
+AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(RDFDataset dataset, std::string eventIDColumnName, int nDecoder) :
+    AsyncEventReader{dataset, RDFEventSplit<AEventIDType>(dataset, std::move(eventIDColumnName)), nDecoder} {}
+
+template<std::integral AEventIDType, TupleModelizable... Ts>
+AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(RDFDataset dataset, std::vector<gsl::index> eventSplit, int nDecoder) :
+    AsyncReader<std::vector<muc::shared_ptrvec<Tuple<Ts...>>>>{
+        ssize(eventSplit) - 1,
+        [this, dataset](gsl::index first, gsl::index last) {
+            const auto& es{fEventSplit};
+            std::vector<muc::shared_ptrvec<Tuple<Ts...>>> data;
+            data.reserve(last - first);
+            internal::TupleArena arena;
+            arena.template Reset<Tuple<Ts...>>(es[last] - es[first]);
+            auto nextEvent{first};
+            auto entry{es[first]};
+            dataset.DataFrame({es[first], es[last]})
+                .Foreach([&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+                    return [&](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
+                        if (entry == es[nextEvent]) {
+                            data.emplace_back().reserve(es[nextEvent + 1] - es[nextEvent]);
+                            ++nextEvent;
+                        }
+                        data.back().emplace_back(arena.template MakeShared<Tuple<Ts...>>(
+                            internal::ReadHelper<Ts...>::template As<
+                                typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+                        ++entry;
+                    };
+                }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
+                         Tuple<Ts...>::NameVector());
+            return data;
+        },
+        nDecoder},
+    fEventSplit{std::move(eventSplit)} {
+    Expects(not fEventSplit.empty());
+    Expects(dataset.NEntry() == fEventSplit.back());
+    Expects(std::ranges::is_sorted(fEventSplit));
+}
+
+template<std::integral AEventIDType, TupleModelizable... Ts>
+AsyncEventReader<AEventIDType, TupleModel<Ts...>>::~AsyncEventReader() {
+    this->Stop();
+}
+
 template<std::integral AEventIDType, TupleModelizable... Ts>
 auto AsyncEventReader<AEventIDType, TupleModel<Ts...>>::Read(gsl::index first, gsl::index last) -> void {
     const auto nEvent{ssize(fEventSplit) - 1};
@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/gslx/index_sequence.h++"
+
+#include "muc/ceta_string"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace Mustard::Data {
+
+namespace internal {
+
+template<typename>
+struct ColumnStorage;
+
+template<typename... AValues>
+struct ColumnStorage<std::tuple<AValues...>> {
+    using Type = std::tuple<std::unique_ptr<typename AValues::Type[]>...>;
+};
+
+} // namespace internal
+
+/// @brief A batch of entries stored column-wise (structure of arrays).
+/// Each column is one contiguous buffer, addressable by the same compile-time
+/// names as Tuple::Get<"name">. A batch costs one allocation per column,
+/// instead of one allocation per entry as for muc::shared_ptrvec<Tuple<Ts...>>.
+/// The container-like members follow standard library naming so that it can be
+/// used as the data of AsyncReader.
+template<TupleModelizable... Ts>
+class ColumnBatch {
+public:
+    using Model = TupleModel<Ts...>;
+
+public:
+    ColumnBatch();
+    ColumnBatch(ColumnBatch&& other) noexcept;
+
+    auto operator=(ColumnBatch&& other) noexcept -> ColumnBatch&;
+
+    /// @brief Column of a value as a contiguous span
+    template<muc::ceta_string AName>
+    auto Get() const -> std::span<const typename Model::template ValueOf<AName>::Type> { return {std::get<Model::template Index<AName>()>(fColumn).get(), fSize}; }
+    template<muc::ceta_string AName>
+    auto Get() -> std::span<typename Model::template ValueOf<AName>::Type> { return {std::get<Model::template Index<AName>()>(fColumn).get(), fSize}; }
+
+    auto size() const -> auto { return fSize; }
+    auto capacity() const -> auto { return fCapacity; }
+    auto empty() const -> auto { return fSize == 0; }
+
+    auto reserve(std::size_t n) -> void;
+    auto clear() -> void { fSize = 0; }
+    auto emplace_back(auto&&... value) -> void;
+
+    static constexpr auto NColumn() -> auto { return Model::Size(); }
+    static constexpr auto NameVector() -> auto { return Model::NameVector(); }
+
+    template<muc::ceta_string AName>
+    friend auto Get(const ColumnBatch<Ts...>& c) -> auto { return c.template Get<AName>(); }
+    template<muc::ceta_string AName>
+    friend auto Get(ColumnBatch<Ts...>& c) -> auto { return c.template Get<AName>(); }
+
+private:
+    typename internal::ColumnStorage<typename Model::StdTuple>::Type fColumn;
+    std::size_t fSize;
+    std::size_t fCapacity;
+};
+
+} // namespace Mustard::Data
+
+#include "Mustard/Data/ColumnBatch.inl"
@@ -0,0 +1,70 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data {
+
+template<TupleModelizable... Ts>
+ColumnBatch<Ts...>::ColumnBatch() :
+    fColumn{},
+    fSize{},
+    fCapacity{} {}
+
+template<TupleModelizable... Ts>
+ColumnBatch<Ts...>::ColumnBatch(ColumnBatch&& other) noexcept :
+    fColumn{std::move(other.fColumn)},
+    fSize{std::exchange(other.fSize, 0)},
+    fCapacity{std::exchange(other.fCapacity, 0)} {}
+
+template<TupleModelizable... Ts>
+auto ColumnBatch<Ts...>::operator=(ColumnBatch&& other) noexcept -> ColumnBatch& {
+    fColumn = std::move(other.fColumn);
+    fSize = std::exchange(other.fSize, 0);
+    fCapacity = std::exchange(other.fCapacity, 0);
+    return *this;
+}
+
+template<TupleModelizable... Ts>
+auto ColumnBatch<Ts...>::reserve(std::size_t n) -> void {
+    if (n <= fCapacity) {
+        return;
+    }
+    [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        ([&](auto& column) {
+            using T = typename std::decay_t<decltype(column)>::element_type;
+            auto newColumn{std::make_unique_for_overwrite<T[]>(n)};
+            std::ranges::move(column.get(), column.get() + fSize, newColumn.get());
+            column = std::move(newColumn);
+        }(std::get<Is>(fColumn)),
+         ...);
+    }(gslx::make_index_sequence<Model::Size()>{});
+    fCapacity = n;
+}
+
+template<TupleModelizable... Ts>
+auto ColumnBatch<Ts...>::emplace_back(auto&&... value) -> void {
+    static_assert(sizeof...(value) == Model::Size());
+    if (fSize == fCapacity) [[unlikely]] {
+        reserve(std::max<std::size_t>(1, 2 * fCapacity));
+    }
+    [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        ((std::get<Is>(fColumn)[fSize] = std::forward<decltype(value)>(value)), ...);
+    }(gslx::make_index_sequence<Model::Size()>{});
+    ++fSize;
+}
+
+} // namespace Mustard::Data
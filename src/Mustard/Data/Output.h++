@@ -20,11 +20,13 @@
 
 #include "Mustard/Data/Tuple.h++"
 #include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/internal/AsyncFillBuffer.h++"
 #include "Mustard/Data/internal/BranchHelper.h++"
 #include "Mustard/Utility/NonCopyableBase.h++"
 
 #include "TDirectory.h"
 #include "TLeaf.h"
+#include "TROOT.h"
 #include "TTree.h"
 
 #include "muc/chrono"
@@ -44,6 +46,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Mustard::Data {
 
@@ -67,6 +70,19 @@ public:
     auto TimedAutoSavePeriod() const -> auto { return fTimedAutoSavePeriod; }
     auto TimedAutoSavePeriod(Second t) -> void { fTimedAutoSavePeriod = t; }
 
+    /// @brief In async fill mode, Fill only appends entries to an in-memory
+    /// buffer of bufferCapacity entries, and a background thread fills the tree
+    /// (including compression, basket flushing and timed autosave). Fill blocks
+    /// only if the previous buffer has not been written yet. Fill returns 0 in
+    /// this mode. Write, NEntry and DisableAsyncFill wait for buffered entries.
+    /// @warning The file of the tree should not be written by other means (e.g.
+    /// TFile::Write) while async fill is enabled.
+    auto AsyncFillEnabled() const -> auto { return fAsyncFillBuffer != nullptr; }
+    auto EnableAsyncFill(std::size_t bufferCapacity = 10000) -> void;
+    auto DisableAsyncFill() -> void { fAsyncFillBuffer.reset(); }
+
+    /// @return Number of bytes filled into the tree. In async fill mode, entries
+    /// are only buffered here and 0 is returned.
     template<typename T = Tuple<Ts...>>
         requires std::assignable_from<Tuple<Ts...>&, T&&> or ProperSubTuple<Tuple<Ts...>, std::decay_t<T>>
     auto Fill(T&& tuple) -> std::size_t;
@@ -86,7 +102,7 @@ public:
 
     auto Write(int option = 0, int bufferSize = 0) const -> std::size_t;
 
-    auto NEntry() const -> auto { return fTree->GetEntries(); }
+    auto NEntry() const -> auto;
 
 private:
     template<typename T = Tuple<Ts...>>
@@ -97,6 +113,7 @@ private:
     auto FillImpl(T&& tuple) -> std::size_t;
 
     auto TimedAutoSaveIfNecessary() -> std::size_t;
+    auto AutoSaveIfDue() -> std::size_t;
 
 private:
     class OutputIterator {
@@ -130,6 +147,8 @@ private:
 
     muc::chrono::stopwatch fAutoSaveStopwatch;
     internal::BranchHelper<Tuple<Ts...>> fBranchHelper;
+
+    std::unique_ptr<internal::AsyncFillBuffer<Tuple<Ts...>>> fAsyncFillBuffer;
 };
 
 } // namespace Mustard::Data
@@ -27,7 +27,8 @@ Output<Ts...>::Output(const std::string& name, const std::string& title,
     fTimedAutoSaveEnabled{enableTimedAutoSave},
     fTimedAutoSavePeriod{timedAutoSavePeriod},
     fAutoSaveStopwatch{},
-    fBranchHelper{fEntry} {
+    fBranchHelper{fEntry},
+    fAsyncFillBuffer{} {
     if (const auto iSlash{name.find_last_of('/')};
         iSlash == std::string::npos) {
         fTree.emplace(name.c_str(), title.c_str());
@@ -92,8 +93,27 @@ auto Output<Ts...>::Fill(R&& data) -> std::size_t {
     return nByte;
 }
 
+template<TupleModelizable... Ts>
+auto Output<Ts...>::EnableAsyncFill(std::size_t bufferCapacity) -> void {
+    fAsyncFillBuffer.reset();
+    ROOT::EnableThreadSafety();
+    fAsyncFillBuffer = std::make_unique<internal::AsyncFillBuffer<Tuple<Ts...>>>(
+        bufferCapacity,
+        [this](std::vector<Tuple<Ts...>>& buffer) {
+            for (auto&& entry : buffer) {
+                fEntry = std::move(entry);
+                fTree->Fill();
+            }
+            AutoSaveIfDue();
+        });
+}
+
 template<TupleModelizable... Ts>
 auto Output<Ts...>::Write(int option, int bufferSize) const -> std::size_t {
+    if (fAsyncFillBuffer) {
+        fAsyncFillBuffer->Flush();
+    }
+    const auto ioLock{internal::AsyncFillBufferBase::IOLock()};
     TDirectory* pwd{gDirectory};
     gDirectory = fTree->GetDirectory();
     const auto nByte{fTree->Write(nullptr, option, bufferSize)};
@@ -101,10 +121,25 @@ auto Output<Ts...>::Write(int option, int bufferSize) const -> std::size_t {
     return nByte;
 }
 
+template<TupleModelizable... Ts>
+auto Output<Ts...>::NEntry() const -> auto {
+    if (fAsyncFillBuffer) {
+        fAsyncFillBuffer->Flush();
+    }
+    return fTree->GetEntries();
+}
+
 template<TupleModelizable... Ts>
 template<typename T>
     requires std::assignable_from<Tuple<Ts...>&, T&&>
 auto Output<Ts...>::FillImpl(T&& tuple) -> std::size_t {
+    if (fAsyncFillBuffer) {
+        Tuple<Ts...> entry;
+        entry = std::forward<T>(tuple);
+        fAsyncFillBuffer->Push(std::move(entry));
+        return 0;
+    }
+    const auto ioLock{internal::AsyncFillBufferBase::IOLock()};
     fEntry = std::forward<T>(tuple);
     return fTree->Fill();
 }
@@ -113,12 +148,26 @@ template<TupleModelizable... Ts>
 template<typename T>
     requires ProperSubTuple<Tuple<Ts...>, std::decay_t<T>>
 auto Output<Ts...>::FillImpl(T&& tuple) -> std::size_t {
+    if (fAsyncFillBuffer) {
+        fAsyncFillBuffer->Push(std::move(std::forward<T>(tuple).template As<Tuple<Ts...>>()));
+        return 0;
+    }
+    const auto ioLock{internal::AsyncFillBufferBase::IOLock()};
     fEntry = std::move(std::forward<T>(tuple).template As<Tuple<Ts...>>());
     return fTree->Fill();
 }
 
 template<TupleModelizable... Ts>
 auto Output<Ts...>::TimedAutoSaveIfNecessary() -> std::size_t {
+    if (fAsyncFillBuffer) {
+        return 0; // done by the writer thread
+    }
+    const auto ioLock{internal::AsyncFillBufferBase::IOLock()};
+    return AutoSaveIfDue();
+}
+
+template<TupleModelizable... Ts>
+auto Output<Ts...>::AutoSaveIfDue() -> std::size_t {
     if (not fTimedAutoSaveEnabled) {
         return 0;
     }
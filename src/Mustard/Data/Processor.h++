@@ -19,6 +19,8 @@
 #pragma once
 
 #include "Mustard/Data/AsyncReader.h++"
+#include "Mustard/Data/ColumnBatch.h++"
+#include "Mustard/Data/RDFDataset.h++"
 #include "Mustard/Data/RDFEventSplit.h++"
 #include "Mustard/Data/TakeFrom.h++"
 #include "Mustard/Data/Tuple.h++"
@@ -31,6 +33,7 @@
 
 #include "mplr/mplr.hpp"
 
+#include "muc/chrono"
 #include "muc/concepts"
 #include "muc/ptrvec"
 #include "muc/utility"
@@ -43,7 +46,6 @@
 #include <cmath>
 #include <concepts>
 #include <functional>
-#include <future>
 #include <memory>
 #include <numeric>
 #include <ranges>
@@ -75,13 +77,34 @@ public:
     auto Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDType>, std::vector<gsl::index> eventSplit,
                  std::invocable<bool, muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index;
 
+    /// @brief Process a dataset by seeking each batch directly (see RDFDataset),
+    /// so that the I/O of each process is proportional only to its own batches.
+    template<TupleModelizable... Ts>
+    auto Process(const RDFDataset& dataset,
+                 std::invocable<bool, std::shared_ptr<Tuple<Ts...>>> auto&& F) -> Index;
+
+    template<TupleModelizable... Ts, std::integral AEventIDType>
+    auto Process(const RDFDataset& dataset, muc::type_tag<AEventIDType>, std::string eventIDBranchName,
+                 std::invocable<bool, muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index;
+    template<TupleModelizable... Ts, std::integral AEventIDType>
+    auto Process(const RDFDataset& dataset, muc::type_tag<AEventIDType>, std::vector<gsl::index> eventSplit,
+                 std::invocable<bool, muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index;
+
+    /// @brief Process entries batch by batch, each batch delivered column-wise
+    /// (one contiguous buffer per value, see ColumnBatch).
+    template<TupleModelizable... Ts>
+    auto ProcessColumn(ROOT::RDF::RNode rdf,
+                       std::invocable<bool, ColumnBatch<Ts...>> auto&& F) -> Index;
+    template<TupleModelizable... Ts>
+    auto ProcessColumn(const RDFDataset& dataset,
+                       std::invocable<bool, ColumnBatch<Ts...>> auto&& F) -> Index;
+
     auto Executor() const -> const auto& { return fExecutor; }
     auto Executor() -> auto& { return fExecutor; }
 
 private:
     template<typename AData>
-    auto ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
-                     std::invocable<bool, typename AData::value_type> auto&& F) -> Index;
+    auto ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what, auto&& F) -> Index;
 
     static auto ByPassOccurrenceCheck(Index n, std::string_view what) -> bool;
 
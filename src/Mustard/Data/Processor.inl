@@ -69,20 +69,93 @@ auto Processor<AExecutor>::Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDT
     return ProcessImpl(asyncReader, nEvent, "events", std::forward<decltype(F)>(F));
 }
 
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts>
+auto Processor<AExecutor>::Process(const RDFDataset& dataset,
+                                   std::invocable<bool, std::shared_ptr<Tuple<Ts...>>> auto&& F) -> Index {
+    const auto nEntry{gsl::narrow<Index>(dataset.NEntry())};
+    if (nEntry == 0) {
+        return 0;
+    }
+
+    AsyncEntryReader<Ts...> asyncReader{dataset, this->NDecoderThread()};
+    return ProcessImpl(asyncReader, nEntry, "entries", std::forward<decltype(F)>(F));
+}
+
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts, std::integral AEventIDType>
+auto Processor<AExecutor>::Process(const RDFDataset& dataset, muc::type_tag<AEventIDType>, std::string eventIDColumnName,
+                                   std::invocable<bool, muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index {
+    auto es{RDFEventSplit<AEventIDType>(dataset, std::move(eventIDColumnName))};
+    return Process<Ts...>(dataset, AEventIDType{}, std::move(es), std::forward<decltype(F)>(F));
+}
+
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts, std::integral AEventIDType>
+auto Processor<AExecutor>::Process(const RDFDataset& dataset, muc::type_tag<AEventIDType>, std::vector<gsl::index> eventSplit,
+                                   std::invocable<bool, muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index {
+    Expects(std::ranges::is_sorted(eventSplit));
+
+    if (eventSplit.empty()) {
+        return 0;
+    }
+    const auto nEntry{eventSplit.back()};
+    if (nEntry != dataset.NEntry()) [[unlikely]] {
+        PrintError(fmt::format("Entries of provided event split ({}) is inconsistent with the dataset ({})",
+                               nEntry, dataset.NEntry()));
+        return 0;
+    }
+    const auto nEvent{gsl::narrow<Index>(eventSplit.size() - 1)};
+
+    AsyncEventReader<AEventIDType, TupleModel<Ts...>> asyncReader{dataset, std::move(eventSplit), this->NDecoderThread()};
+    return ProcessImpl(asyncReader, nEvent, "events", std::forward<decltype(F)>(F));
+}
+
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts>
+auto Processor<AExecutor>::ProcessColumn(ROOT::RDF::RNode rdf,
+                                         std::invocable<bool, ColumnBatch<Ts...>> auto&& F) -> Index {
+    const auto nEntry{gsl::narrow<Index>(*rdf.Count())};
+    if (nEntry == 0) {
+        return 0;
+    }
+
+    AsyncColumnReader<Ts...> asyncReader{std::move(rdf)};
+    return ProcessImpl(asyncReader, nEntry, "entries", std::forward<decltype(F)>(F));
+}
+
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts>
+auto Processor<AExecutor>::ProcessColumn(const RDFDataset& dataset,
+                                         std::invocable<bool, ColumnBatch<Ts...>> auto&& F) -> Index {
+    const auto nEntry{gsl::narrow<Index>(dataset.NEntry())};
+    if (nEntry == 0) {
+        return 0;
+    }
+
+    AsyncColumnReader<Ts...> asyncReader{dataset, this->NDecoderThread()};
+    return ProcessImpl(asyncReader, nEntry, "entries", std::forward<decltype(F)>(F));
+}
+
 template<muc::instantiated_from<Executor> AExecutor>
 template<typename AData>
-auto Processor<AExecutor>::ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
-                                       std::invocable<bool, typename AData::value_type> auto&& F) -> Index {
-    AData batchData;
+auto Processor<AExecutor>::ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what, auto&& F) -> Index {
+    constexpr auto columnar{muc::instantiated_from<AData, ColumnBatch>};
 
     Index nProcessed{};
-    const auto ProcessBatch{[&] {
-        for (auto&& data : batchData) {
-            std::invoke(std::forward<decltype(F)>(F), /*byPass =*/false, std::move(data));
-        }
+    this->fComputeTime = {};
+    const auto ProcessBatch{[&](AData batchData) {
+        muc::chrono::stopwatch stopwatch;
         nProcessed += batchData.size();
+        if constexpr (columnar) {
+            std::invoke(std::forward<decltype(F)>(F), /*byPass =*/false, std::move(batchData));
+        } else {
+            for (auto&& data : batchData) {
+                std::invoke(std::forward<decltype(F)>(F), /*byPass =*/false, std::move(data));
+            }
+        }
+        this->fComputeTime += stopwatch.read();
     }};
-    std::future<void> asyncProcess;
 
     const auto byPassWillOccur{ByPassOccurrenceCheck(n, what)};
     const auto worldComm{mplr::comm_world()};
@@ -90,25 +163,27 @@ auto Processor<AExecutor>::ProcessImpl(AsyncReader<AData>& asyncReader, Index n,
     fExecutor(std::max(static_cast<Index>(worldComm.size()), batch.nBatch), [&](auto k) { // k is batch index
         if (byPassWillOccur) [[unlikely]] {
             if (k >= n) { // by pass when there are too many processes
-                std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, typename AData::value_type{});
+                if constexpr (columnar) {
+                    std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, AData{});
+                } else {
+                    std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, typename AData::value_type{});
+                }
                 return;
             }
         }
         const auto [iFirst, iLast]{this->CalculateIndexRange(k, batch)};
-        if (asyncReader.Reading()) {
-            batchData = asyncReader.Acquire();
-        }
         asyncReader.Read(iFirst, iLast);
-        if (asyncProcess.valid()) {
-            asyncProcess.get();
+        if (asyncReader.NQueued() > this->ReadAheadDepth()) {
+            ProcessBatch(asyncReader.Acquire());
         }
-        asyncProcess = std::async(std::launch::deferred, ProcessBatch);
     });
-    batchData = asyncReader.Acquire();
-    asyncProcess.get();
+    while (asyncReader.Reading()) {
+        ProcessBatch(asyncReader.Acquire());
+    }
     if (not asyncReader.Exhausted()) {
         asyncReader.Exhaust();
     }
+    this->fIOWaitTime = asyncReader.AcquireWaitTime();
 
     return nProcessed;
 }
@@ -0,0 +1,59 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Data/RDFDataset.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "TChain.h"
+
+#include "fmt/core.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Mustard::Data {
+
+RDFDataset::RDFDataset(std::string treeName, std::vector<std::string> fileName) :
+    fTreeName{std::move(treeName)},
+    fFileName{std::move(fileName)},
+    fNEntry{},
+    fEventSplitIndex{} {
+    TChain chain{fTreeName.c_str()};
+    for (auto&& file : fFileName) {
+        chain.Add(file.c_str());
+    }
+    const auto nEntry{chain.GetEntries()};
+    if (nEntry < 0) {
+        Throw<std::runtime_error>(fmt::format("Cannot read number of entries of '{}'", fTreeName));
+    }
+    fNEntry = nEntry;
+}
+
+auto RDFDataset::DataFrame() const -> ROOT::RDF::RNode {
+    return ROOT::RDataFrame{fTreeName, fFileName};
+}
+
+auto RDFDataset::DataFrame(RDFEntryRange range) const -> ROOT::RDF::RNode {
+    Expects(0 <= range.first and range.first <= range.last and range.last <= fNEntry);
+    ROOT::RDF::Experimental::RDatasetSpec spec;
+    spec.AddSample({"", fTreeName, fFileName});
+    spec.WithGlobalRange({range.first, range.last});
+    return ROOT::RDataFrame{spec};
+}
+
+} // namespace Mustard::Data
@@ -0,0 +1,63 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Data/RDFEntryRange.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Data {
+
+/// @brief A TTree dataset (tree name and file names) that can be opened directly
+/// at an entry range. Unlike an RNode, reading a range from it seeks to the first
+/// entry of the range rather than visiting every preceding entry, so that the I/O
+/// of a process reading a batch is proportional only to the batch size.
+class RDFDataset {
+public:
+    RDFDataset(std::string treeName, std::vector<std::string> fileName);
+
+    auto TreeName() const -> const auto& { return fTreeName; }
+    auto FileName() const -> const auto& { return fFileName; }
+    auto NEntry() const -> auto { return fNEntry; }
+
+    /// @brief ROOT file caching event splits of this dataset (see RDFEventSplit).
+    /// Empty (default) if event splits should not be cached.
+    auto EventSplitIndex() const -> const auto& { return fEventSplitIndex; }
+    auto EventSplitIndex(std::filesystem::path val) -> void { fEventSplitIndex = std::move(val); }
+
+    /// @brief Data frame over the whole dataset
+    auto DataFrame() const -> ROOT::RDF::RNode;
+    /// @brief Data frame over entries in [range.first, range.last) of the dataset
+    auto DataFrame(RDFEntryRange range) const -> ROOT::RDF::RNode;
+
+private:
+    std::string fTreeName;
+    std::vector<std::string> fFileName;
+    gsl::index fNEntry;
+    std::filesystem::path fEventSplitIndex;
+};
+
+} // namespace Mustard::Data
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include "Mustard/Data/RDFDataset.h++"
+#include "Mustard/Data/RDFEntryRange.h++"
+#include "Mustard/Data/internal/RDFEventSplitIndex.h++"
 #include "Mustard/IO/PrettyLog.h++"
 
 #include "ROOT/RDataFrame.hxx"
@@ -36,6 +39,8 @@
 #include <array>
 #include <concepts>
 #include <limits>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <stdexcept>
 #include <string>
@@ -48,10 +53,13 @@ template<std::integral T>
 auto RDFEventSplit(ROOT::RDF::RNode rdf,
                    std::string eventIDColumnName) -> std::vector<gsl::index>;
 
-struct RDFEntryRange {
-    gsl::index first;
-    gsl::index last;
-};
+/// @brief Event split of a dataset, built in parallel: each process scans a
+/// disjoint entry range, and events across range boundaries are stitched.
+/// If the dataset has an event split index file (see RDFDataset), the split is
+/// loaded from it when up to date, otherwise built and saved to it.
+template<std::integral T>
+auto RDFEventSplit(const RDFDataset& dataset,
+                   std::string eventIDColumnName) -> std::vector<gsl::index>;
 
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
@@ -23,18 +23,22 @@ namespace {
 
 template<std::integral T>
 auto MakeFlatRDFEventSplit(ROOT::RDF::RNode rdf,
-                           std::string eventIDColumnName) -> std::pair<std::vector<T>, std::vector<gsl::index>> {
+                           std::string eventIDColumnName,
+                           gsl::index firstEntry = 0,
+                           bool checkUniqueness = true) -> std::pair<std::vector<T>, std::vector<gsl::index>> {
     std::vector<T> eventIDList;
     std::vector<gsl::index> eventSplit;
 
-    gsl::index index{};
+    gsl::index index{firstEntry};
     muc::flat_hash_set<T> eventIDSet;
     rdf.Foreach(
         [&](T eventID) {
             if (eventIDList.empty() or eventID != eventIDList.back()) {
-                const auto [_, uniqueEventID]{eventIDSet.emplace(eventID)};
-                if (not uniqueEventID) [[unlikely]] {
-                    PrintError(fmt::format("There are more than one event {})", eventID));
+                if (checkUniqueness) {
+                    const auto [_, uniqueEventID]{eventIDSet.emplace(eventID)};
+                    if (not uniqueEventID) [[unlikely]] {
+                        PrintError(fmt::format("There are more than one event {})", eventID));
+                    }
                 }
                 eventIDList.emplace_back(eventID);
                 eventSplit.emplace_back(index);
@@ -47,6 +51,68 @@ auto MakeFlatRDFEventSplit(ROOT::RDF::RNode rdf,
     return {std::move(eventIDList), std::move(eventSplit)};
 }
 
+template<std::integral T>
+auto MakeParallelRDFEventSplit(const RDFDataset& dataset,
+                               const std::string& eventIDColumnName) -> std::vector<gsl::index> {
+    const auto worldComm{mplr::comm_world()};
+    const auto nProcess{worldComm.size()};
+    const auto nEntry{dataset.NEntry()};
+
+    // Scan entries of this process
+    const RDFEntryRange range{nEntry * worldComm.rank() / nProcess,
+                              nEntry * (worldComm.rank() + 1) / nProcess};
+    auto [localEventID, localEventSplit]{
+        range.first == range.last ?
+            std::pair{std::vector<T>{}, std::vector<gsl::index>{range.first}} :
+            MakeFlatRDFEventSplit<T>(dataset.DataFrame(range), eventIDColumnName, range.first, false)};
+    localEventSplit.pop_back();
+
+    // Share partial event splits with all processes
+    std::vector<gsl::index> nLocalEvent(nProcess);
+    worldComm.allgather(ssize(localEventID), nLocalEvent.data());
+    std::vector<std::vector<T>> eventID(nProcess);
+    std::vector<std::vector<gsl::index>> partialEventSplit(nProcess);
+    eventID[worldComm.rank()] = std::move(localEventID);
+    partialEventSplit[worldComm.rank()] = std::move(localEventSplit);
+    mplr::irequest_pool bcastPartialES;
+    for (int i{}; i < nProcess; ++i) {
+        if (nLocalEvent[i] == 0) {
+            continue;
+        }
+        eventID[i].resize(nLocalEvent[i]);
+        partialEventSplit[i].resize(nLocalEvent[i]);
+        bcastPartialES.push(worldComm.ibcast(i, eventID[i].data(), mplr::vector_layout<T>{eventID[i].size()}));
+        bcastPartialES.push(worldComm.ibcast(i, partialEventSplit[i].data(), mplr::vector_layout<gsl::index>{partialEventSplit[i].size()}));
+    }
+    bcastPartialES.waitall();
+
+    // Stitch: an event across the boundary of two ranges starts in the former
+    std::vector<gsl::index> eventSplit;
+    eventSplit.reserve(std::accumulate(nLocalEvent.cbegin(), nLocalEvent.cend(), gsl::index{1}));
+    muc::flat_hash_set<T> eventIDSet;
+    std::optional<T> lastEventID;
+    for (int i{}; i < nProcess; ++i) {
+        for (gsl::index j{}; j < nLocalEvent[i]; ++j) {
+            if (j == 0 and eventID[i][j] == lastEventID) {
+                continue;
+            }
+            if (worldComm.rank() == 0) {
+                const auto [_, uniqueEventID]{eventIDSet.emplace(eventID[i][j])};
+                if (not uniqueEventID) [[unlikely]] {
+                    PrintError(fmt::format("There are more than one event {})", eventID[i][j]));
+                }
+            }
+            eventSplit.emplace_back(partialEventSplit[i][j]);
+        }
+        if (nLocalEvent[i] != 0) {
+            lastEventID = eventID[i].back();
+        }
+    }
+    eventSplit.emplace_back(nEntry);
+
+    return eventSplit;
+}
+
 } // namespace
 } // namespace internal
 
@@ -69,6 +135,44 @@ auto RDFEventSplit(ROOT::RDF::RNode rdf,
     }
 }
 
+template<std::integral T>
+auto RDFEventSplit(const RDFDataset& dataset,
+                   std::string eventIDColumnName) -> std::vector<gsl::index> {
+    const auto useIndex{not dataset.EventSplitIndex().empty()};
+    if (not mplr::available()) {
+        if (useIndex) {
+            if (auto eventSplit{internal::LoadRDFEventSplit(dataset, eventIDColumnName)}) {
+                return *std::move(eventSplit);
+            }
+        }
+        auto eventSplit{internal::MakeFlatRDFEventSplit<T>(dataset.DataFrame(), eventIDColumnName).second};
+        if (useIndex) {
+            internal::SaveRDFEventSplit(dataset, eventIDColumnName, eventSplit);
+        }
+        return eventSplit;
+    }
+
+    const auto worldComm{mplr::comm_world()};
+    if (useIndex) {
+        // An index has at least one element (#entry) if loaded
+        auto eventSplit{worldComm.rank() == 0 ?
+                            internal::LoadRDFEventSplit(dataset, eventIDColumnName).value_or(std::vector<gsl::index>{}) :
+                            std::vector<gsl::index>{}};
+        auto eventSplitSize{eventSplit.size()};
+        worldComm.bcast(0, eventSplitSize);
+        if (eventSplitSize != 0) {
+            eventSplit.resize(eventSplitSize);
+            worldComm.bcast(0, eventSplit.data(), mplr::vector_layout<gsl::index>{eventSplit.size()});
+            return eventSplit;
+        }
+    }
+    auto eventSplit{internal::MakeParallelRDFEventSplit<T>(dataset, eventIDColumnName)};
+    if (useIndex and worldComm.rank() == 0) {
+        internal::SaveRDFEventSplit(dataset, eventIDColumnName, eventSplit);
+    }
+    return eventSplit;
+}
+
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
                    const std::string& eventIDColumnName) -> std::vector<std::array<RDFEntryRange, N>> {
@@ -28,6 +28,7 @@
 #include "Mustard/Utility/ProgressBar.h++"
 #include "Mustard/gslx/index_sequence.h++"
 
+#include "muc/chrono"
 #include "muc/concepts"
 #include "muc/numeric"
 #include "muc/ptrvec"
@@ -163,33 +163,31 @@ auto SeqProcessor::Process(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf,
 template<typename AData>
 auto SeqProcessor::ProcessImpl(AsyncReader<AData>& asyncReader, Index n,
                                std::invocable<typename AData::value_type> auto&& F) -> Index {
-    AData batchData;
-
     Index nProcessed{};
-    const auto ProcessBatch{[&] {
+    fComputeTime = {};
+    const auto ProcessBatch{[&](AData batchData) {
+        muc::chrono::stopwatch stopwatch;
         for (auto&& data : batchData) {
             std::invoke(std::forward<decltype(F)>(F), std::move(data));
             ++nProcessed;
             IterationEndAction();
         }
+        fComputeTime += stopwatch.read();
     }};
-    std::future<void> asyncProcess;
 
     const auto batch{CalculateBatchConfiguration(1, n)};
     LoopBeginAction(n);
     for (Index k{}; k < batch.nBatch; ++k) { // k is batch index
         const auto [iFirst, iLast]{CalculateIndexRange(k, batch)};
-        if (asyncReader.Reading()) {
-            batchData = asyncReader.Acquire();
-        }
         asyncReader.Read(iFirst, iLast);
-        if (asyncProcess.valid()) {
-            asyncProcess.get();
+        if (asyncReader.NQueued() > ReadAheadDepth()) {
+            ProcessBatch(asyncReader.Acquire());
         }
-        asyncProcess = std::async(std::launch::deferred, ProcessBatch);
     }
-    batchData = asyncReader.Acquire();
-    asyncProcess.get();
+    while (asyncReader.Reading()) {
+        ProcessBatch(asyncReader.Acquire());
+    }
+    fIOWaitTime = asyncReader.AcquireWaitTime();
     LoopEndAction();
 
     return nProcessed;
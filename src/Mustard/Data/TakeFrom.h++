@@ -20,6 +20,7 @@
 
 #include "Mustard/Data/Tuple.h++"
 #include "Mustard/Data/internal/ReadHelper.h++"
+#include "Mustard/Data/internal/TupleArena.h++"
 #include "Mustard/Utility/NonConstructibleBase.h++"
 #include "Mustard/gslx/index_sequence.h++"
 
@@ -43,7 +44,7 @@ private:
     class TakeOne;
 
     template<gsl::index... Is>
-    TakeOne(muc::shared_ptrvec<Tuple<Ts...>>, gslx::index_sequence<Is...>) -> TakeOne<Is...>;
+    TakeOne(muc::shared_ptrvec<Tuple<Ts...>>, internal::TupleArena, gslx::index_sequence<Is...>) -> TakeOne<Is...>;
 };
 
 } // namespace Mustard::Data
@@ -22,7 +22,9 @@ template<TupleModelizable... Ts>
 auto Take<Ts...>::From(ROOT::RDF::RNode rdf) -> muc::shared_ptrvec<Tuple<Ts...>> {
     muc::shared_ptrvec<Tuple<Ts...>> data;
     // data.reserve(*rdf.Count());   -- slow!
-    rdf.Foreach(TakeOne{data, gslx::make_index_sequence<Tuple<Ts...>::Size()>{}},
+    // tuples share one arena, freed when the last of them is destroyed
+    internal::TupleArena arena;
+    rdf.Foreach(TakeOne{data, arena, gslx::make_index_sequence<Tuple<Ts...>::Size()>{}},
                 Tuple<Ts...>::NameVector());
     return data;
 }
@@ -31,17 +33,19 @@ template<TupleModelizable... Ts>
 template<gsl::index... Is>
 class Take<Ts...>::TakeOne {
 public:
-    TakeOne(muc::shared_ptrvec<Tuple<Ts...>>& data, gslx::index_sequence<Is...>) :
-        fData{data} {}
+    TakeOne(muc::shared_ptrvec<Tuple<Ts...>>& data, internal::TupleArena& arena, gslx::index_sequence<Is...>) :
+        fData{data},
+        fArena{arena} {}
 
     auto operator()(const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) -> void {
-        fData.emplace_back(std::make_shared<Tuple<Ts...>>(
+        fData.emplace_back(fArena.template MakeShared<Tuple<Ts...>>(
             internal::ReadHelper<Ts...>::template As<
                 typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
     }
 
 private:
     muc::shared_ptrvec<Tuple<Ts...>>& fData;
+    internal::TupleArena& fArena;
 };
 
 } // namespace Mustard::Data
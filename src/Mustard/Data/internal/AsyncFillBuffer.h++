@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonCopyableBase.h++"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Data::internal {
+
+class AsyncFillBufferBase : public NonCopyableBase {
+protected:
+    AsyncFillBufferBase() = default;
+    ~AsyncFillBufferBase() = default;
+
+public:
+    /// @brief Serializes ROOT I/O of all asynchronous writers with each other
+    /// and with the caller. Always locks, since a writer may start at any time.
+    static auto IOLock() -> std::unique_lock<std::mutex> { return std::unique_lock{fgIOMutex}; }
+
+private:
+    static inline std::mutex fgIOMutex;
+};
+
+/// @brief Double buffer handing entries over to a writer thread.
+/// Entries are appended to the front buffer. Once it is full, it is swapped
+/// with the back buffer, which the writer thread empties by Write. If the
+/// writer is still busy with the previous buffer, the swap waits for it
+/// (back-pressure), so that at most two buffers of entries are in memory.
+template<typename T>
+class AsyncFillBuffer final : public AsyncFillBufferBase {
+public:
+    AsyncFillBuffer(std::size_t capacity, std::function<void(std::vector<T>&)> Write);
+    ~AsyncFillBuffer();
+
+    auto Capacity() const -> auto { return fCapacity; }
+
+    auto Push(T entry) -> void;
+    /// @brief Write all pushed entries and wait for completion.
+    auto Flush() -> void;
+
+private:
+    auto Submit() -> void;
+
+private:
+    std::size_t fCapacity;
+    std::vector<T> fFrontBuffer;
+    std::vector<T> fBackBuffer;
+    bool fBackBufferPending;
+    bool fStop;
+    std::mutex fMutex;
+    std::condition_variable fSubmitted;
+    std::condition_variable fWritten;
+    std::jthread fWriterThread;
+};
+
+} // namespace Mustard::Data::internal
+
+#include "Mustard/Data/internal/AsyncFillBuffer.inl"
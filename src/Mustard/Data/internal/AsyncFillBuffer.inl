@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data::internal {
+
+template<typename T>
+AsyncFillBuffer<T>::AsyncFillBuffer(std::size_t capacity, std::function<void(std::vector<T>&)> Write) :
+    AsyncFillBufferBase{},
+    fCapacity{std::max<std::size_t>(1, capacity)},
+    fFrontBuffer{},
+    fBackBuffer{},
+    fBackBufferPending{},
+    fStop{},
+    fMutex{},
+    fSubmitted{},
+    fWritten{},
+    fWriterThread{} {
+    fFrontBuffer.reserve(fCapacity);
+    fBackBuffer.reserve(fCapacity);
+    fWriterThread = std::jthread{
+        [this](std::function<void(std::vector<T>&)> Write) {
+            while (true) {
+                std::unique_lock lock{fMutex};
+                fSubmitted.wait(lock, [this] { return fBackBufferPending or fStop; });
+                if (not fBackBufferPending) {
+                    return;
+                }
+                lock.unlock();
+                {
+                    const auto ioLock{IOLock()};
+                    std::invoke(Write, fBackBuffer);
+                }
+                fBackBuffer.clear();
+                lock.lock();
+                fBackBufferPending = false;
+                lock.unlock();
+                fWritten.notify_one();
+            }
+        },
+        std::move(Write)};
+}
+
+template<typename T>
+AsyncFillBuffer<T>::~AsyncFillBuffer() {
+    Flush();
+    {
+        const std::scoped_lock lock{fMutex};
+        fStop = true;
+    }
+    fSubmitted.notify_one();
+    fWriterThread.join();
+}
+
+template<typename T>
+auto AsyncFillBuffer<T>::Push(T entry) -> void {
+    fFrontBuffer.emplace_back(std::move(entry));
+    if (fFrontBuffer.size() >= fCapacity) {
+        Submit();
+    }
+}
+
+template<typename T>
+auto AsyncFillBuffer<T>::Flush() -> void {
+    if (not fFrontBuffer.empty()) {
+        Submit();
+    }
+    std::unique_lock lock{fMutex};
+    fWritten.wait(lock, [this] { return not fBackBufferPending; });
+}
+
+template<typename T>
+auto AsyncFillBuffer<T>::Submit() -> void {
+    std::unique_lock lock{fMutex};
+    fWritten.wait(lock, [this] { return not fBackBufferPending; });
+    std::swap(fFrontBuffer, fBackBuffer);
+    fBackBufferPending = true;
+    lock.unlock();
+    fSubmitted.notify_one();
+}
+
+} // namespace Mustard::Data::internal
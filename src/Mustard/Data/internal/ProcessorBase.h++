@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "muc/chrono"
 #include "muc/math"
 
 #include "gsl/gsl"
@@ -41,6 +42,18 @@ protected:
 public:
     auto BatchSizeProposal(T val) -> void { fBatchSizeProposal = std::max(1, val); }
     auto BatchSizeProposal() const -> auto { return fBatchSizeProposal; }
+    /// @brief Number of batches read ahead of the one being processed.
+    auto ReadAheadDepth(int val) -> void { fReadAheadDepth = std::max(1, val); }
+    auto ReadAheadDepth() const -> auto { return fReadAheadDepth; }
+    /// @brief Number of threads reading batches concurrently. Takes effect only
+    /// when processing an RDFDataset, where batches are read independently.
+    auto NDecoderThread(int val) -> void { fNDecoderThread = std::max(1, val); }
+    auto NDecoderThread() const -> auto { return fNDecoderThread; }
+
+    /// @brief Time the last Process call spent waiting for data.
+    auto IOWaitTime() const -> auto { return fIOWaitTime; }
+    /// @brief Time the last Process call spent in user code.
+    auto ComputeTime() const -> auto { return fComputeTime; }
 
 protected:
     struct BatchConfiguration {
@@ -52,8 +65,14 @@ protected:
     auto CalculateBatchConfiguration(T nProcess, T nTotal) const -> BatchConfiguration;
     static auto CalculateIndexRange(T iBatch, BatchConfiguration batch) -> std::pair<T, T>;
 
+protected:
+    muc::chrono::seconds<double> fIOWaitTime;
+    muc::chrono::seconds<double> fComputeTime;
+
 private:
     T fBatchSizeProposal;
+    int fReadAheadDepth;
+    int fNDecoderThread;
 };
 
 } // namespace Mustard::Data::internal
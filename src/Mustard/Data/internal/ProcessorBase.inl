@@ -20,7 +20,11 @@ namespace Mustard::Data::internal {
 
 template<std::integral T>
 ProcessorBase<T>::ProcessorBase() :
-    fBatchSizeProposal{300000} {}
+    fIOWaitTime{},
+    fComputeTime{},
+    fBatchSizeProposal{300000},
+    fReadAheadDepth{1},
+    fNDecoderThread{1} {}
 
 template<std::integral T>
 auto ProcessorBase<T>::CalculateBatchConfiguration(T nProcess, T nTotal) const -> BatchConfiguration {
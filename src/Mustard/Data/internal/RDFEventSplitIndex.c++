@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Data/RDFDataset.h++"
+#include "Mustard/Data/internal/RDFEventSplitIndex.h++"
+#include "Mustard/IO/File.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "RtypesCore.h"
+#include "TFile.h"
+#include "TNamed.h"
+
+#include "fmt/core.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace Mustard::Data::internal {
+
+namespace {
+
+// Tree names can be paths like "dir/tree", which are not valid object names
+// in a TFile. Escape everything except letters and digits.
+auto EscapeKeyName(std::string_view name) -> std::string {
+    std::string escaped;
+    escaped.reserve(name.size());
+    for (auto&& c : name) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            escaped += c;
+        } else {
+            escaped += fmt::format("_{:02x}", static_cast<unsigned char>(c));
+        }
+    }
+    return escaped;
+}
+
+auto EventSplitKey(const RDFDataset& dataset, std::string_view eventIDColumnName) -> std::string {
+    return fmt::format("EventSplit_{}_{}", EscapeKeyName(dataset.TreeName()), EscapeKeyName(eventIDColumnName));
+}
+
+auto EventSplitSignatureKey(const RDFDataset& dataset, std::string_view eventIDColumnName) -> std::string {
+    return fmt::format("EventSplitSource_{}_{}", EscapeKeyName(dataset.TreeName()), EscapeKeyName(eventIDColumnName));
+}
+
+// Identifies the data an event split was built from. Local files also
+// contribute their size and modification time, so that rewriting a file in
+// place invalidates the split.
+auto EventSplitSignature(const RDFDataset& dataset) -> std::string {
+    auto signature{fmt::format("{}", dataset.NEntry())};
+    for (auto&& fileName : dataset.FileName()) {
+        std::error_code ec;
+        const auto size{std::filesystem::file_size(fileName, ec)};
+        const auto time{ec ? std::filesystem::file_time_type{} : std::filesystem::last_write_time(fileName, ec)};
+        if (ec) {
+            signature += fmt::format(";{}", fileName);
+        } else {
+            signature += fmt::format(";{}:{}:{}", fileName, size, time.time_since_epoch().count());
+        }
+    }
+    return signature;
+}
+
+} // namespace
+
+auto LoadRDFEventSplit(const RDFDataset& dataset, std::string_view eventIDColumnName) -> std::optional<std::vector<gsl::index>> {
+    const auto& indexPath{dataset.EventSplitIndex()};
+    if (indexPath.empty() or not std::filesystem::exists(indexPath)) {
+        return std::nullopt;
+    }
+    File<TFile> file{indexPath};
+
+    const std::unique_ptr<TNamed> signature{file->Get<TNamed>(EventSplitSignatureKey(dataset, eventIDColumnName).c_str())};
+    if (signature == nullptr) {
+        return std::nullopt;
+    }
+    if (signature->GetTitle() != EventSplitSignature(dataset)) {
+        PrintWarning(fmt::format("Event split of '{}' in '{}' is outdated and will be rebuilt",
+                                 eventIDColumnName, indexPath));
+        return std::nullopt;
+    }
+    const std::unique_ptr<std::vector<Long64_t>> storedEventSplit{
+        file->Get<std::vector<Long64_t>>(EventSplitKey(dataset, eventIDColumnName).c_str())};
+    if (storedEventSplit == nullptr or storedEventSplit->empty() or
+        storedEventSplit->back() != dataset.NEntry() or
+        not std::ranges::is_sorted(*storedEventSplit)) {
+        PrintWarning(fmt::format("Event split of '{}' in '{}' is corrupted and will be rebuilt",
+                                 eventIDColumnName, indexPath));
+        return std::nullopt;
+    }
+    return std::vector<gsl::index>(storedEventSplit->cbegin(), storedEventSplit->cend());
+}
+
+auto SaveRDFEventSplit(const RDFDataset& dataset, std::string_view eventIDColumnName, const std::vector<gsl::index>& eventSplit) -> void {
+    const auto& indexPath{dataset.EventSplitIndex()};
+    if (indexPath.empty()) {
+        return;
+    }
+    try {
+        File<TFile> file{indexPath, "UPDATE"};
+        const std::vector<Long64_t> storedEventSplit(eventSplit.cbegin(), eventSplit.cend());
+        file->WriteObject(&storedEventSplit, EventSplitKey(dataset, eventIDColumnName).c_str(), "Overwrite");
+        TNamed signature{EventSplitSignatureKey(dataset, eventIDColumnName), EventSplitSignature(dataset)};
+        file->WriteTObject(&signature, nullptr, "Overwrite");
+    } catch (const std::exception& e) {
+        PrintWarning(fmt::format("Event split of '{}' cannot be saved to '{}' ({})",
+                                 eventIDColumnName, indexPath, e.what()));
+    }
+}
+
+} // namespace Mustard::Data::internal
@@ -0,0 +1,42 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "gsl/gsl"
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Mustard::Data {
+
+class RDFDataset;
+
+namespace internal {
+
+/// @brief Load the event split of a dataset from its event split index file.
+/// Returns std::nullopt if there is no index, or the index is not up to date
+/// with the dataset.
+auto LoadRDFEventSplit(const RDFDataset& dataset, std::string_view eventIDColumnName) -> std::optional<std::vector<gsl::index>>;
+/// @brief Save the event split of a dataset to its event split index file.
+auto SaveRDFEventSplit(const RDFDataset& dataset, std::string_view eventIDColumnName, const std::vector<gsl::index>& eventSplit) -> void;
+
+} // namespace internal
+
+} // namespace Mustard::Data
@@ -0,0 +1,86 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace Mustard::Data::internal {
+
+/// @brief Allocator allocating from a shared monotonic arena. Deallocation is a
+/// no-op; the arena is released when the last allocator copy (including those
+/// stored in shared_ptr control blocks) is destroyed.
+template<typename T>
+class ArenaAllocator {
+    template<typename>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+
+public:
+    ArenaAllocator(std::shared_ptr<std::pmr::monotonic_buffer_resource> arena) noexcept :
+        fArena{std::move(arena)} {}
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+        fArena{other.fArena} {}
+
+    auto allocate(std::size_t n) -> T* { return static_cast<T*>(fArena->allocate(n * sizeof(T), alignof(T))); }
+    auto deallocate(T*, std::size_t) noexcept -> void {}
+
+    template<typename U>
+    auto operator==(const ArenaAllocator<U>& that) const noexcept -> bool { return fArena == that.fArena; }
+
+private:
+    std::shared_ptr<std::pmr::monotonic_buffer_resource> fArena;
+};
+
+/// @brief Per-batch arena for shared tuples. All tuples created between two
+/// Reset() share one monotonic buffer, so a batch performs a few large
+/// allocations instead of one heap allocation per tuple. The buffer is freed
+/// when the last tuple of the batch is destroyed.
+/// Not thread-safe: tuples should be created by one thread at a time.
+class TupleArena {
+public:
+    TupleArena() :
+        fArena{} {}
+
+    template<typename T>
+    auto Reset(std::size_t nObject) -> void {
+        fArena = std::make_shared<std::pmr::monotonic_buffer_resource>(std::max<std::size_t>(1, nObject) * (sizeof(T) + fgControlBlockSizeEstimation));
+    }
+
+    template<typename T>
+    auto MakeShared(auto&&... args) -> std::shared_ptr<T> {
+        if (not fArena) [[unlikely]] {
+            Reset<T>(1);
+        }
+        return std::allocate_shared<T>(ArenaAllocator<T>{fArena}, std::forward<decltype(args)>(args)...);
+    }
+
+private:
+    std::shared_ptr<std::pmr::monotonic_buffer_resource> fArena;
+
+    static constexpr std::size_t fgControlBlockSizeEstimation{64};
+};
+
+} // namespace Mustard::Data::internal
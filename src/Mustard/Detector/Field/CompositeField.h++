@@ -0,0 +1,144 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectricField.h++"
+#include "Mustard/Detector/Field/ElectricFieldBase.h++"
+#include "Mustard/Detector/Field/ElectromagneticField.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/FieldSupport.h++"
+#include "Mustard/Detector/Field/MagneticField.h++"
+#include "Mustard/Detector/Field/MagneticFieldBase.h++"
+#include "Mustard/Detector/Field/internal/FieldSupportIndex.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include "muc/array"
+
+#include "gsl/gsl"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A component of `CompositeField`: a field and its support.
+template<ElectromagneticField AField>
+struct CompositeFieldComponent {
+    std::unique_ptr<AField> field;
+    FieldSupport support{};
+};
+
+template<ElectromagneticField... AFields>
+class CompositeField;
+
+namespace internal {
+
+template<typename ADerived>
+class CompositeMagneticFieldInterface : public MagneticFieldBase<ADerived> {
+public:
+    template<Concept::NumericVector3D T>
+    auto B(T x) const -> T {
+        return static_cast<const ADerived&>(*this).Superpose(x, [](const auto& field, T x) { return field.B(x); });
+    }
+};
+
+template<typename ADerived>
+class CompositeElectricFieldInterface : public ElectricFieldBase<ADerived> {
+public:
+    template<Concept::NumericVector3D T>
+    auto E(T x) const -> T {
+        return static_cast<const ADerived&>(*this).Superpose(x, [](const auto& field, T x) { return field.E(x); });
+    }
+};
+
+template<typename ADerived>
+class CompositeElectromagneticFieldInterface : public ElectromagneticFieldBase<ADerived> {
+public:
+    template<Concept::NumericVector3D T>
+    auto B(T x) const -> T {
+        return static_cast<const ADerived&>(*this).Superpose(x, [](const auto& field, T x) { return field.B(x); });
+    }
+    template<Concept::NumericVector3D T>
+    auto E(T x) const -> T {
+        return static_cast<const ADerived&>(*this).Superpose(x, [](const auto& field, T x) { return field.E(x); });
+    }
+    template<Concept::NumericVector3D T>
+    auto BE(T x) const -> typename ElectromagneticFieldBase<ADerived>::template F<T> {
+        return static_cast<const ADerived&>(*this).SuperposeBE(x);
+    }
+};
+
+template<typename ADerived, typename... AFields>
+using CompositeFieldInterface =
+    std::conditional_t<(MagneticField<AFields> and ...),
+                       CompositeMagneticFieldInterface<ADerived>,
+                       std::conditional_t<(ElectricField<AFields> and ...),
+                                          CompositeElectricFieldInterface<ADerived>,
+                                          CompositeElectromagneticFieldInterface<ADerived>>>;
+
+} // namespace internal
+
+/// @brief Superposition of several fields, e.g. uniform fields, toroid fields
+/// and local field maps. Each component only contributes inside its support
+/// box. A uniform grid index over the supports selects the components to be
+/// evaluated at a point, so a query only pays for fields that matter there.
+/// @note It is a magnetic (electric) field if all components are magnetic
+/// (electric), otherwise an electromagnetic field. Can be used with
+/// `AsG4Field`, e.g. `AsG4Field<CompositeField<UniformMagneticField, ToroidField>>`.
+template<ElectromagneticField... AFields>
+class CompositeField : public internal::CompositeFieldInterface<CompositeField<AFields...>, AFields...> {
+    static_assert(sizeof...(AFields) >= 1 and sizeof...(AFields) <= 64);
+
+    friend class internal::CompositeMagneticFieldInterface<CompositeField>;
+    friend class internal::CompositeElectricFieldInterface<CompositeField>;
+    friend class internal::CompositeElectromagneticFieldInterface<CompositeField>;
+
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectromagneticFieldBase<CompositeField>::template F<T>;
+
+public:
+    /// @param component Component fields and their supports.
+    explicit CompositeField(CompositeFieldComponent<AFields>... component);
+
+    template<std::size_t I>
+    auto Component() const -> const auto& { return *std::get<I>(fField); }
+    auto Support() const -> const auto& { return fSupport; }
+
+private:
+    template<Concept::NumericVector3D T, typename AEvaluate>
+    auto Superpose(T x, AEvaluate&& Evaluate) const -> T;
+    template<Concept::NumericVector3D T>
+    auto SuperposeBE(T x) const -> F<T>;
+
+private:
+    std::tuple<std::unique_ptr<AFields>...> fField;
+    std::array<FieldSupport, sizeof...(AFields)> fSupport;
+    internal::FieldSupportIndex fIndex;
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/CompositeField.inl"
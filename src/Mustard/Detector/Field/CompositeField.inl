@@ -0,0 +1,70 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<ElectromagneticField... AFields>
+CompositeField<AFields...>::CompositeField(CompositeFieldComponent<AFields>... component) :
+    internal::CompositeFieldInterface<CompositeField<AFields...>, AFields...>{},
+    fField{std::move(component.field)...},
+    fSupport{component.support...},
+    fIndex{fSupport} {
+    std::apply([](const auto&... field) { Expects(((field != nullptr) and ...)); }, fField);
+}
+
+template<ElectromagneticField... AFields>
+template<Concept::NumericVector3D T, typename AEvaluate>
+auto CompositeField<AFields...>::Superpose(T x, AEvaluate&& Evaluate) const -> T {
+    const auto x0{VectorCast<muc::array3d>(x)};
+    const auto candidate{fIndex.Candidate(x0)};
+    muc::array3d sum{};
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ([&] {
+            if ((candidate >> Is & 1) and fSupport[Is].Contains(x0)) {
+                const auto f{Evaluate(*std::get<Is>(fField), x)};
+                sum[0] += f[0];
+                sum[1] += f[1];
+                sum[2] += f[2];
+            }
+        }(), ...);
+    }(std::index_sequence_for<AFields...>{});
+    return VectorCast<T>(sum);
+}
+
+template<ElectromagneticField... AFields>
+template<Concept::NumericVector3D T>
+auto CompositeField<AFields...>::SuperposeBE(T x) const -> F<T> {
+    const auto x0{VectorCast<muc::array3d>(x)};
+    const auto candidate{fIndex.Candidate(x0)};
+    muc::array3d b{};
+    muc::array3d e{};
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ([&] {
+            if ((candidate >> Is & 1) and fSupport[Is].Contains(x0)) {
+                const auto [fB, fE]{std::get<Is>(fField)->BE(x)};
+                for (int i{}; i < 3; ++i) {
+                    b[i] += fB[i];
+                    e[i] += fE[i];
+                }
+            }
+        }(), ...);
+    }(std::index_sequence_for<AFields...>{});
+    return {VectorCast<T>(b), VectorCast<T>(e)};
+}
+
+} // namespace Mustard::Detector::Field
@@ -22,6 +22,7 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectricFieldBase.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/internal/FieldMapBatch.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -33,6 +34,10 @@
 
 #include "muc/functional"
 
+#include "gsl/gsl"
+
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 /// @brief A functional type converts E-field SI field value
@@ -54,11 +59,20 @@ template<typename AFieldMap = EFM::FieldMap3D<Eigen::Vector3d, double, muc::mult
     requires std::same_as<typename AFieldMap::CoordinateType, double>
 class ElectricFieldMap : public ElectricFieldBase<ElectricFieldMap<AFieldMap>>,
                          public AFieldMap {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename ElectricFieldBase<ElectricFieldMap<AFieldMap>>::template F<T>;
+
 public:
     using AFieldMap::AFieldMap;
 
     template<Concept::NumericVector3D T>
     auto E(T x) const -> T { return VectorCast<T>((*this)(x[0], x[1], x[2])); }
+
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void;
 };
 
 /// @brief An YZ plane mirror symmetry electric field interpolated from data.
@@ -97,3 +111,5 @@ using ElectricFieldMapSymmetryXYZ = ElectricFieldMap<
     EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, EFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
 } // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/ElectricFieldMap.inl"
@@ -0,0 +1,47 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<typename AFieldMap>
+    requires std::same_as<typename AFieldMap::CoordinateType, double>
+template<Concept::NumericVector3D T>
+auto ElectricFieldMap<AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == e.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& f) { e[i] = {f[0], f[1], f[2]}; });
+    } else {
+        ElectricFieldBase<ElectricFieldMap<AFieldMap>>::BatchE(x, e);
+    }
+}
+
+template<typename AFieldMap>
+    requires std::same_as<typename AFieldMap::CoordinateType, double>
+template<Concept::NumericVector3D T>
+auto ElectricFieldMap<AFieldMap>::BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == f.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& fi) { f[i] = {{0, 0, 0}, {fi[0], fi[1], fi[2]}}; });
+    } else {
+        ElectricFieldBase<ElectricFieldMap<AFieldMap>>::BatchBE(x, f);
+    }
+}
+
+} // namespace Mustard::Detector::Field
@@ -23,7 +23,11 @@
 
 #include "muc/array"
 
+#include "gsl/gsl"
+
+#include <algorithm>
 #include <concepts>
+#include <span>
 
 namespace Mustard::Detector::Field {
 
@@ -46,6 +50,18 @@ public:
 protected:
     constexpr ElectromagneticFieldBase();
     constexpr ~ElectromagneticFieldBase() = default;
+
+public:
+    /// @brief Evaluate B-field at many points. Evaluates point by point by
+    /// default, derived fields may provide faster implementations.
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    /// @brief Evaluate E-field at many points. See `BatchB`.
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    /// @brief Evaluate B- and E-field at many points. See `BatchB`.
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void;
 };
 
 } // namespace Mustard::Detector::Field
@@ -24,4 +24,28 @@ constexpr ElectromagneticFieldBase<ADerived>::ElectromagneticFieldBase() {
     static_assert(ElectromagneticField<ADerived>);
 }
 
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    Expects(x.size() == b.size());
+    const auto& self{static_cast<const ADerived&>(*this)};
+    std::ranges::transform(x, b.begin(), [&](const T& xi) { return self.B(xi); });
+}
+
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    Expects(x.size() == e.size());
+    const auto& self{static_cast<const ADerived&>(*this)};
+    std::ranges::transform(x, e.begin(), [&](const T& xi) { return self.E(xi); });
+}
+
+template<typename ADerived>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldBase<ADerived>::BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void {
+    Expects(x.size() == f.size());
+    const auto& self{static_cast<const ADerived&>(*this)};
+    std::ranges::transform(x, f.begin(), [&](const T& xi) { return self.BE(xi); });
+}
+
 } // namespace Mustard::Detector::Field
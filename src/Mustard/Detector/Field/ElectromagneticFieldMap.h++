@@ -22,6 +22,11 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/OctreeFieldMap3D.h++"
+#include "Mustard/Detector/Field/SharedFieldMapStorage.h++"
+#include "Mustard/Detector/Field/internal/FieldCache.h++"
+#include "Mustard/Detector/Field/internal/FieldMapBatch.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -34,8 +39,11 @@
 #include "muc/ceta_string"
 #include "muc/functional"
 
+#include "gsl/gsl"
+
 #include <concepts>
-#include <limits>
+#include <span>
+#include <type_traits>
 
 namespace Mustard::Detector::Field {
 
@@ -61,11 +69,15 @@ struct BEFieldSI2CLHEP : ATransformation {
 /// @tparam AFieldMap A field map type, e.g. `EFM::FieldMap3D<T>` or
 /// `EFM::FieldMap3DSymZ<Eigen::Vector<double, .
 /// @note "WithCache" and "NoCache" decides whether field cache will be used.
-/// "WithCache" field will reuse the field value calculated in last calculation if
-/// this calculation happens exactly at the same position. In principle, "WithCache"
-/// accelerates cases when there are many subsequent calls to E or B or EB with same x:
+/// "WithCache" field caches per thread, so one field object can be shared by
+/// all threads. If `AFieldMap` evaluates cellwise (e.g. `GridFieldMap3D`), the
+/// corner values of a few recently visited grid cells are cached, which serves
+/// repeated queries inside the same cell, e.g. from Runge-Kutta steppers.
+/// Otherwise the field value at the last evaluated point is cached, which
+/// serves subsequent calls to B, E or BE with same x:
 ///     Something(field.E(x), field.B(x));
-/// However, if these cases do not matter or you need maximum performace in EB then
+/// Each thread keeps separate caches for a few recently used field objects.
+/// If these cases do not matter or you need maximum performace then
 /// "NoCache" would be better.
 template<muc::ceta_string ACache = "WithCache",
          typename AFieldMap = EFM::FieldMap3D<Eigen::Vector<double, 6>, double, muc::multidentity, BEFieldSI2CLHEP<>>>
@@ -90,9 +102,21 @@ public:
     template<Concept::NumericVector3D T>
     auto BE(T x) const -> F<T>;
 
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void;
+
 private:
-    mutable Eigen::Vector3d fCachedX{std::numeric_limits<double>::quiet_NaN(), 0, 0};
-    mutable typename AFieldMap::ValueType fCache;
+    auto Evaluate(double x, double y, double z) const -> auto;
+
+private:
+    static constexpr auto fgNCachedCell{4};
+    static constexpr auto fgNCacheOwner{4};
+
+    internal::FieldCacheOwner fCacheOwner;
 };
 
 template<typename AFieldMap>
@@ -111,6 +135,13 @@ public:
     auto E(T x) const -> T;
     template<Concept::NumericVector3D T>
     auto BE(T x) const -> F<T>;
+
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchE(std::span<const T> x, std::span<T> e) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void;
 };
 
 /// @brief An YZ plane mirror symmetry electromagnetic field interpolated from data.
@@ -155,6 +186,32 @@ template<muc::ceta_string ACache = "WithCache", Concept::MathVector<double, 6> T
 using ElectromagneticFieldMapSymmetryXYZ = ElectromagneticFieldMap<
     ACache, EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, BEFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
+/// @brief An axisymmetric electromagnetic field interpolated from (r, z) data,
+/// with columns r, z, Br, Bphi, Bz, Er, Ephi, Ez by default. See `GridFieldMap3D`.
+/// @tparam ACache Use cache or not. See `ElectromagneticFieldMap`.
+template<muc::ceta_string ACache = "WithCache", Concept::MathVector<double, 6> T = Eigen::Vector<double, 6>,
+         typename AStorage = PrivateFieldMapStorage,
+         muc::ceta_string APrecision = "Double">
+using ElectromagneticFieldMapAxisymmetry = ElectromagneticFieldMap<
+    ACache, GridFieldMap3D<T, CoordinateAxisymmetry, BEFieldSI2CLHEP<FieldAxisymmetry>, AStorage, APrecision>>;
+
+/// @brief An electromagnetic field interpolated from data. Processes on the
+/// same node share a single copy of the field map. See `SharedFieldMapStorage`.
+/// @tparam ACache Use cache or not. See `ElectromagneticFieldMap`.
+/// @tparam APrecision Precision of stored field values. See `GridFieldMap3D`.
+template<muc::ceta_string ACache = "WithCache", Concept::MathVector<double, 6> T = Eigen::Vector<double, 6>,
+         muc::ceta_string APrecision = "Double">
+using SharedElectromagneticFieldMap = ElectromagneticFieldMap<
+    ACache, GridFieldMap3D<T, muc::multidentity, BEFieldSI2CLHEP<>, SharedFieldMapStorage, APrecision>>;
+
+/// @brief An electromagnetic field interpolated from data stored in an
+/// adaptive octree, constructed with (file name, tree name, tolerance in SI
+/// units). See `OctreeFieldMap3D`.
+/// @tparam ACache Use cache or not. See `ElectromagneticFieldMap`.
+template<muc::ceta_string ACache = "WithCache", Concept::MathVector<double, 6> T = Eigen::Vector<double, 6>>
+using ElectromagneticFieldMapOctree = ElectromagneticFieldMap<
+    ACache, OctreeFieldMap3D<T, muc::multidentity, BEFieldSI2CLHEP<>>>;
+
 } // namespace Mustard::Detector::Field
 
 #include "Mustard/Detector/Field/ElectromagneticFieldMap.inl"
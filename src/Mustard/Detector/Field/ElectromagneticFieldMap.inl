@@ -21,35 +21,72 @@ namespace Mustard::Detector::Field {
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"WithCache", AFieldMap>::B(T x) const -> T {
-    const auto xEigen{VectorCast<Eigen::Vector3d>(x)};
-    if (xEigen != fCachedX) {
-        fCachedX = xEigen;
-        fCache = (*this)(x[0], x[1], x[2]);
-    }
-    const auto& f{*fCache};
+    const auto f{Evaluate(x[0], x[1], x[2])};
     return {f[0], f[1], f[2]};
 }
 
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"WithCache", AFieldMap>::E(T x) const -> T {
-    const auto xEigen{VectorCast<Eigen::Vector3d>(x)};
-    if (xEigen != fCachedX) {
-        fCachedX = xEigen;
-        fCache = (*this)(x[0], x[1], x[2]);
-    }
-    const auto& f{*fCache};
+    const auto f{Evaluate(x[0], x[1], x[2])};
     return {f[3], f[4], f[5]};
 }
 
 template<typename AFieldMap>
 template<Concept::NumericVector3D T>
 auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BE(T x) const -> F<T> {
-    fCachedX = VectorCast<Eigen::Vector3d>(x);
-    fCache = (*this)(x[0], x[1], x[2]);
-    const auto& f{*fCache};
-    return {VectorCast<T>(f[0], f[1], f[2]),
-            VectorCast<T>(f[3], f[4], f[5])};
+    const auto f{Evaluate(x[0], x[1], x[2])}; // clang-format off
+    return {{f[0], f[1], f[2]}, {f[3], f[4], f[5]}}; // clang-format on
+}
+
+template<typename AFieldMap>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::Evaluate(double x, double y, double z) const -> auto {
+    if constexpr (internal::CellwiseFieldMap<AFieldMap>) {
+        thread_local internal::FieldCacheSet<internal::CellFieldCache<typename AFieldMap::CellValue, fgNCachedCell>, fgNCacheOwner> cache;
+        const auto [cell, t]{this->Locate(x, y, z)};
+        const auto& corner{cache[fCacheOwner].Get(cell, [this](auto i) { return this->Corner(i); })};
+        return (*this)(x, y, z, corner, t);
+    } else {
+        using FieldValue = std::remove_cvref_t<decltype((*this)(x, y, z))>;
+        thread_local internal::FieldCacheSet<internal::PointFieldCache<FieldValue>, fgNCacheOwner> cache;
+        return cache[fCacheOwner].Get(Eigen::Vector3d{x, y, z}, [&] { return (*this)(x, y, z); });
+    }
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == b.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& f) { b[i] = {f[0], f[1], f[2]}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"WithCache", AFieldMap>>::BatchB(x, b);
+    }
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == e.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& f) { e[i] = {f[3], f[4], f[5]}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"WithCache", AFieldMap>>::BatchE(x, e);
+    }
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"WithCache", AFieldMap>::BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == f.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& fi) { f[i] = {{fi[0], fi[1], fi[2]}, {fi[3], fi[4], fi[5]}}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"WithCache", AFieldMap>>::BatchBE(x, f);
+    }
 }
 
 template<typename AFieldMap>
@@ -73,4 +110,40 @@ auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BE(T x) const -> F<T> {
     return {{v[0], v[1], v[2]}, {v[3], v[4], v[5]}}; // clang-format on
 }
 
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchB(std::span<const T> x, std::span<T> b) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == b.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& f) { b[i] = {f[0], f[1], f[2]}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"NoCache", AFieldMap>>::BatchB(x, b);
+    }
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchE(std::span<const T> x, std::span<T> e) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == e.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& f) { e[i] = {f[3], f[4], f[5]}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"NoCache", AFieldMap>>::BatchE(x, e);
+    }
+}
+
+template<typename AFieldMap>
+template<Concept::NumericVector3D T>
+auto ElectromagneticFieldMap<"NoCache", AFieldMap>::BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void {
+    if constexpr (internal::SoAFieldMap<AFieldMap>) {
+        Expects(x.size() == f.size());
+        internal::EvaluateSoA(static_cast<const AFieldMap&>(*this), x,
+                              [&](auto i, const auto& fi) { f[i] = {{fi[0], fi[1], fi[2]}, {fi[3], fi[4], fi[5]}}; });
+    } else {
+        ElectromagneticFieldBase<ElectromagneticFieldMap<"NoCache", AFieldMap>>::BatchBE(x, f);
+    }
+}
+
 } // namespace Mustard::Detector::Field
@@ -23,7 +23,11 @@
 
 #include "muc/math"
 
+#include <array>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <string>
 #include <tuple>
 
 namespace Mustard::Detector::Field {
@@ -182,4 +186,46 @@ struct FieldSymmetryXYZ {
     }
 };
 
+/// @brief Rotational symmetry around z-axis. Map (x, y, z) to (r, 0, z) on an
+/// (r, z) field map.
+struct CoordinateAxisymmetry {
+    template<std::floating_point C>
+    [[nodiscard]] MUSTARD_ALWAYS_INLINE auto operator()(C x, C y, C z) const noexcept -> std::tuple<C, C, C> {
+        return {std::sqrt(x * x + y * y), C{}, z};
+    }
+
+    /// @brief Columns of an (r, z) field map, used by `GridFieldMap3D`.
+    template<std::size_t N>
+    static auto DefaultColumnName() -> std::array<std::string, 3 + N> {
+        if constexpr (N == 3) {
+            return {"r", "", "z", "Br", "Bphi", "Bz"};
+        } else {
+            return {"r", "", "z", "Br", "Bphi", "Bz", "Er", "Ephi", "Ez"};
+        }
+    }
+};
+
+/// @brief Rotational symmetry around z-axis. Rotate the field from
+/// (r, phi, z) components to (x, y, z) components at (x, y, z).
+struct FieldAxisymmetry {
+    template<std::floating_point C, typename T>
+        requires Concept::NumericVector<T, C, 3> or Concept::NumericVector<T, C, 6>
+    [[nodiscard]] MUSTARD_ALWAYS_INLINE auto operator()(C x, C y, C, T f) const noexcept -> T {
+        const auto r{std::sqrt(x * x + y * y)};
+        const auto cosPhi{r > 0 ? x / r : 1};
+        const auto sinPhi{r > 0 ? y / r : 0};
+        const auto Rotate{[&](int i) {
+            const auto fR{f[i]};
+            const auto fPhi{f[i + 1]};
+            f[i] = cosPhi * fR - sinPhi * fPhi;
+            f[i + 1] = sinPhi * fR + cosPhi * fPhi;
+        }};
+        Rotate(0);
+        if constexpr (Concept::NumericVector<T, C, 6>) {
+            Rotate(3);
+        }
+        return f;
+    }
+};
+
 } // namespace Mustard::Detector::Field
@@ -0,0 +1,49 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "muc/array"
+
+#include <limits>
+
+namespace Mustard::Detector::Field {
+
+/// @brief An axis-aligned box bounding the region where a field is non-zero.
+/// Unbounded by default.
+struct FieldSupport {
+    muc::array3d min{-std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity()};
+    muc::array3d max{std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity()};
+
+    auto Contains(const muc::array3d& x) const -> bool {
+        return min[0] <= x[0] and x[0] <= max[0] and
+               min[1] <= x[1] and x[1] <= max[1] and
+               min[2] <= x[2] and x[2] <= max[2];
+    }
+    auto Bounded() const -> bool {
+        return min[0] > -std::numeric_limits<double>::infinity() and max[0] < std::numeric_limits<double>::infinity() and
+               min[1] > -std::numeric_limits<double>::infinity() and max[1] < std::numeric_limits<double>::infinity() and
+               min[2] > -std::numeric_limits<double>::infinity() and max[2] < std::numeric_limits<double>::infinity();
+    }
+};
+
+} // namespace Mustard::Detector::Field
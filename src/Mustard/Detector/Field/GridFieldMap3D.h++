@@ -0,0 +1,142 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/PrivateFieldMapStorage.h++"
+#include "Mustard/Detector/Field/internal/FieldMapCache.h++"
+#include "Mustard/Detector/Field/internal/FieldMapGrid.h++"
+#include "Mustard/Detector/Field/internal/GridFieldValue.h++"
+#include "Mustard/Detector/Field/internal/Trilinear.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+#include "Mustard/gslx/index_sequence.h++"
+
+#include "EFM/FieldMap3D.h++"
+
+#include "muc/ceta_string"
+#include "muc/functional"
+#include "muc/utility"
+
+#include "gsl/gsl"
+
+#include "fmt/core.h"
+#include "fmt/ranges.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field map sampled on a uniform 3D grid, evaluated by trilinear
+/// interpolation. Can be used as the `AFieldMap` of `MagneticFieldMap`,
+/// `ElectricFieldMap` and `ElectromagneticFieldMap`.
+/// @tparam T Field value type.
+/// @tparam ACoordinateTransformation Applied to coordinates before interpolation
+/// (e.g. `CoordinateSymmetryX`).
+/// @tparam AFieldTransformation Applied to interpolated value (e.g. `BFieldSI2CLHEP<>`).
+/// @tparam AStorage Where the grid values live, `PrivateFieldMapStorage` or
+/// `SharedFieldMapStorage`.
+/// @tparam APrecision Precision of stored grid values, "Double", "Float" or
+/// "Quantized". See `internal::GridFieldValue`. Evaluation is always in double.
+/// @note The field map is read from a ROOT tree with one entry per grid point.
+/// Points outside the grid take the value at the nearest grid boundary.
+/// @note On first load, a binary cache of the grid is written beside the ROOT
+/// file (see `internal::FieldMapCachePath`), one per precision and symmetry.
+/// Later loads map the cache into memory instead of parsing the ROOT file. The
+/// cache is rebuilt when the ROOT file, column names or transformations change.
+template<typename T,
+         typename ACoordinateTransformation = muc::multidentity,
+         typename AFieldTransformation = EFM::Identity,
+         typename AStorage = PrivateFieldMapStorage,
+         muc::ceta_string APrecision = "Double">
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+class GridFieldMap3D {
+public:
+    using ValueType = T;
+    using CoordinateType = double;
+
+    static constexpr std::size_t NComponent{sizeof(T) / sizeof(double)};
+
+    /// @brief A point located in the grid: index of the cell and local
+    /// coordinates of the point in it, each in [0, 1].
+    struct CellPosition {
+        std::size_t cell;
+        std::array<double, 3> t;
+    };
+    /// @brief Field values on the 8 corners of a grid cell.
+    using CellValue = std::array<double, 8 * NComponent>;
+
+public:
+    /// @brief Read field map from a ROOT file.
+    /// @param fileName ROOT file name.
+    /// @param treeName Name of the tree storing the field map.
+    /// @param columnName Coordinate column names followed by value column names.
+    /// Defaults to x, y, z, Bx, By, Bz (, Ex, Ey, Ez), or to what
+    /// `ACoordinateTransformation::DefaultColumnName<NComponent>()` gives if
+    /// provided. Electric field maps with 3 components should give their
+    /// column names explicitly. An empty coordinate name makes a degenerate
+    /// axis, e.g. for (r, z) maps.
+    GridFieldMap3D(const std::filesystem::path& fileName, const std::string& treeName,
+                   const std::array<std::string, 3 + NComponent>& columnName = DefaultColumnName());
+
+    MUSTARD_ALWAYS_INLINE auto operator()(double x, double y, double z) const -> T;
+
+    /// @brief Locate the grid cell containing (x, y, z).
+    MUSTARD_ALWAYS_INLINE auto Locate(double x, double y, double z) const -> CellPosition;
+    /// @brief Fetch field values on the corners of a grid cell.
+    MUSTARD_ALWAYS_INLINE auto Corner(std::size_t cell) const -> CellValue;
+    /// @brief Evaluate field at (x, y, z) from corner values of the cell
+    /// containing it. Allows callers to reuse corner values of a cell.
+    MUSTARD_ALWAYS_INLINE auto operator()(double x, double y, double z, const CellValue& corner, const std::array<double, 3>& t) const -> T;
+    /// @brief Evaluate field at many points in SoA layout: `f[k][i]` receives
+    /// component k of the field at (`x[i]`, `y[i]`, `z[i]`). Loops are laid out
+    /// for the compiler to vectorize (with gathers on e.g. AVX2 and AVX-512).
+    auto operator()(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                    const std::array<std::span<double>, NComponent>& f) const -> void;
+    /// @brief Stored field value at grid point (i, j, k), before field transformation.
+    MUSTARD_ALWAYS_INLINE auto Value(int i, int j, int k) const -> std::array<double, NComponent>;
+
+    auto Grid() const -> const auto& { return fGrid; }
+    auto Storage() const -> const auto& { return fStorage; }
+
+    static auto DefaultColumnName() -> std::array<std::string, 3 + NComponent>;
+
+private:
+    [[no_unique_address]] ACoordinateTransformation fCoordinateTransformation;
+    [[no_unique_address]] AFieldTransformation fFieldTransformation;
+    internal::FieldMapGrid fGrid;
+    std::array<double, 3> fInverseDelta;
+    std::array<std::size_t, 3> fStride;
+    AStorage fStorage;
+    internal::GridFieldValue<APrecision, NComponent> fValue;
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/GridFieldMap3D.inl"
@@ -0,0 +1,214 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::GridFieldMap3D(
+    const std::filesystem::path& fileName, const std::string& treeName,
+    const std::array<std::string, 3 + NComponent>& columnName) :
+    fCoordinateTransformation{},
+    fFieldTransformation{},
+    fGrid{},
+    fInverseDelta{},
+    fStride{},
+    fStorage{},
+    fValue{} {
+    const std::array coordinateName{columnName[0], columnName[1], columnName[2]};
+    const auto signature{fmt::format("{};{};{};{}", fmt::join(columnName, ","), APrecision.sv(),
+                                     muc::try_demangle(typeid(ACoordinateTransformation).name()),
+                                     muc::try_demangle(typeid(AFieldTransformation).name()))};
+    const auto cachePath{internal::FieldMapCachePath(fileName, treeName, signature)};
+    using Value = internal::GridFieldValue<APrecision, NComponent>;
+    internal::FieldMapCacheInfo cache{};
+    if (fStorage.Leader()) {
+        if (const auto validCache{internal::ReadFieldMapCache(cachePath, fileName, signature)};
+            validCache and validCache->dataSize == Value::Size(validCache->grid.NPoint())) {
+            cache = *validCache;
+        } else {
+            cache.grid = internal::ScanFieldMapGrid(fileName, treeName, coordinateName);
+        }
+    }
+    fStorage.Broadcast(cache);
+    if (cache.dataOffset != 0) {
+        // the cache may have been replaced or removed after the leader validated it,
+        // and every process must reach the collective check below even if mapping fails
+        bool validMap{};
+        try {
+            fStorage.Map(cachePath, cache.dataOffset);
+            validMap = internal::CheckMappedFieldMapCache(fStorage.Mapped(), signature, cache);
+        } catch (const std::runtime_error& e) {
+            PrintWarning(e.what());
+        }
+        if (not fStorage.AllOf(validMap)) {
+            if (fStorage.Leader()) {
+                PrintWarning(fmt::format("Field map cache '{}' changed while being loaded, reading '{}' instead", cachePath, fileName));
+                cache = {};
+                cache.grid = internal::ScanFieldMapGrid(fileName, treeName, coordinateName);
+            }
+            fStorage.Broadcast(cache);
+        }
+    }
+    fGrid = cache.grid;
+    const auto nPoint{fGrid.NPoint()};
+    if (cache.dataOffset == 0) {
+        const auto buffer{fStorage.Allocate(Value::Size(nPoint))};
+        if (fStorage.Leader()) {
+            const auto valueName{std::span{columnName}.subspan(3)};
+            if constexpr (APrecision == "Double") {
+                internal::ReadFieldMapValue(fileName, treeName, coordinateName, valueName, fGrid,
+                                            {reinterpret_cast<double*>(buffer.data()), nPoint * NComponent});
+            } else {
+                std::vector<double> value(nPoint * NComponent);
+                internal::ReadFieldMapValue(fileName, treeName, coordinateName, valueName, fGrid, value);
+                Value::Encode(value, buffer);
+            }
+            internal::WriteFieldMapCache(cachePath, fileName, signature, fGrid, buffer);
+        }
+        fStorage.Publish();
+    }
+    fValue = {fStorage.Data(), nPoint};
+    for (int i{}; i < 3; ++i) {
+        fInverseDelta[i] = 1 / fGrid.delta[i];
+    }
+    // zero stride along degenerate axes
+    fStride[2] = fGrid.n[2] > 1 ? NComponent : 0;
+    fStride[1] = fGrid.n[1] > 1 ? fGrid.n[2] * NComponent : 0;
+    fStride[0] = fGrid.n[0] > 1 ? static_cast<std::size_t>(fGrid.n[1]) * fGrid.n[2] * NComponent : 0;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::operator()(double x, double y, double z) const -> T {
+    const auto [cell, t]{Locate(x, y, z)};
+    return (*this)(x, y, z, Corner(cell), t);
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::Locate(double x, double y, double z) const -> CellPosition {
+    const auto [u, v, w]{fCoordinateTransformation(x, y, z)};
+    const std::array c{u, v, w};
+    CellPosition position;
+    position.cell = 0;
+    for (int d{}; d < 3; ++d) {
+        const auto s{std::clamp((c[d] - fGrid.min[d]) * fInverseDelta[d], 0., fGrid.n[d] - 1.)};
+        const auto i{std::max(0, std::min(static_cast<int>(s), fGrid.n[d] - 2))};
+        position.cell = position.cell * fGrid.n[d] + i;
+        position.t[d] = s - i;
+    }
+    return position;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::Corner(std::size_t cell) const -> CellValue {
+    const auto [sx, sy, sz]{fStride};
+    const std::array<std::size_t, 8> offset{0, sz, sy, sy + sz, sx, sx + sz, sx + sy, sx + sy + sz};
+    const auto first{cell * NComponent};
+    CellValue corner;
+    for (int i{}; i < 8; ++i) {
+        for (std::size_t k{}; k < NComponent; ++k) {
+            corner[i * NComponent + k] = fValue[first + offset[i] + k];
+        }
+    }
+    return corner;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::operator()(double x, double y, double z, const CellValue& corner, const std::array<double, 3>& t) const -> T {
+    const auto f{internal::Trilinear<NComponent>(corner, t)};
+    return fFieldTransformation(x, y, z, [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return T{f[Is]...};
+    }(gslx::make_index_sequence<NComponent>{}));
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::operator()(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                                                                                             const std::array<std::span<double>, NComponent>& f) const -> void {
+    const auto n{x.size()};
+    Expects(y.size() == n and z.size() == n);
+    Expects(std::ranges::all_of(f, [n](auto&& fk) { return fk.size() == n; }));
+
+    const auto [sx, sy, sz]{fStride};
+    constexpr std::size_t blockSize{64};
+    std::array<std::size_t, blockSize> offset;
+    std::array<std::array<double, blockSize>, 3> t;
+    for (std::size_t begin{}; begin < n; begin += blockSize) {
+        const auto m{std::min(blockSize, n - begin)};
+        for (std::size_t i{}; i < m; ++i) {
+            const auto [cell, ti]{Locate(x[begin + i], y[begin + i], z[begin + i])};
+            offset[i] = cell * NComponent;
+            t[0][i] = ti[0];
+            t[1][i] = ti[1];
+            t[2][i] = ti[2];
+        }
+        // one component at a time: gather and blend are independent across points
+        for (std::size_t k{}; k < NComponent; ++k) {
+            const auto v{[this, k](std::size_t j) { return fValue[j + k]; }};
+            const auto fk{f[k].data() + begin};
+            for (std::size_t i{}; i < m; ++i) {
+                const auto o{offset[i]};
+                const auto f00{v(o) + t[2][i] * (v(o + sz) - v(o))};
+                const auto f01{v(o + sy) + t[2][i] * (v(o + sy + sz) - v(o + sy))};
+                const auto f10{v(o + sx) + t[2][i] * (v(o + sx + sz) - v(o + sx))};
+                const auto f11{v(o + sx + sy) + t[2][i] * (v(o + sx + sy + sz) - v(o + sx + sy))};
+                const auto f0{f00 + t[1][i] * (f01 - f00)};
+                const auto f1{f10 + t[1][i] * (f11 - f10)};
+                fk[i] = f0 + t[0][i] * (f1 - f0);
+            }
+        }
+        for (std::size_t i{}; i < m; ++i) {
+            const auto j{begin + i};
+            const auto fj{fFieldTransformation(x[j], y[j], z[j], [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+                return T{f[Is][j]...};
+            }(gslx::make_index_sequence<NComponent>{}))};
+            for (std::size_t k{}; k < NComponent; ++k) {
+                f[k][j] = fj[k];
+            }
+        }
+    }
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::Value(int i, int j, int k) const -> std::array<double, NComponent> {
+    const auto first{((static_cast<std::size_t>(i) * fGrid.n[1] + j) * fGrid.n[2] + k) * NComponent};
+    std::array<double, NComponent> f;
+    for (std::size_t c{}; c < NComponent; ++c) {
+        f[c] = fValue[first + c];
+    }
+    return f;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation, typename AStorage, muc::ceta_string APrecision>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>::DefaultColumnName() -> std::array<std::string, 3 + NComponent> {
+    if constexpr (requires { ACoordinateTransformation::template DefaultColumnName<NComponent>(); }) {
+        return ACoordinateTransformation::template DefaultColumnName<NComponent>();
+    } else if constexpr (NComponent == 3) {
+        return {"x", "y", "z", "Bx", "By", "Bz"};
+    } else {
+        return {"x", "y", "z", "Bx", "By", "Bz", "Ex", "Ey", "Ez"};
+    }
+}
+
+} // namespace Mustard::Detector::Field
@@ -21,7 +21,11 @@
 #include "Mustard/Concept/MathVector.h++"
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/FieldMapSymmetry.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
 #include "Mustard/Detector/Field/MagneticFieldBase.h++"
+#include "Mustard/Detector/Field/OctreeFieldMap3D.h++"
+#include "Mustard/Detector/Field/SharedFieldMapStorage.h++"
+#include "Mustard/Detector/Field/internal/FieldMapBatch.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 #include "Mustard/Utility/VectorCast.h++"
 
@@ -31,8 +35,13 @@
 
 #include "EFM/FieldMap3D.h++"
 
+#include "muc/ceta_string"
 #include "muc/functional"
 
+#include "gsl/gsl"
+
+#include <span>
+
 namespace Mustard::Detector::Field {
 
 /// @brief A functional type converts B-field SI field value
@@ -54,11 +63,20 @@ template<typename AFieldMap = EFM::FieldMap3D<Eigen::Vector3d, double, muc::mult
     requires std::same_as<typename AFieldMap::CoordinateType, double>
 class MagneticFieldMap : public MagneticFieldBase<MagneticFieldMap<AFieldMap>>,
                          public AFieldMap {
+private:
+    template<Concept::NumericVector3D T>
+    using F = typename MagneticFieldBase<MagneticFieldMap<AFieldMap>>::template F<T>;
+
 public:
     using AFieldMap::AFieldMap;
 
     template<Concept::NumericVector3D T>
     auto B(T x) const -> T { return VectorCast<T>((*this)(x[0], x[1], x[2])); }
+
+    template<Concept::NumericVector3D T>
+    auto BatchB(std::span<const T> x, std::span<T> b) const -> void;
+    template<Concept::NumericVector3D T>
+    auto BatchBE(std::span<const T> x, std::span<F<T>> f) const -> void;
 };
 
 /// @brief An YZ plane mirror symmetry magnetic field interpolated from data.
@@ -96,4 +114,28 @@ template<Concept::MathVector3D T = Eigen::Vector3d>
 using MagneticFieldMapSymmetryXYZ = MagneticFieldMap<
     EFM::FieldMap3D<T, double, CoordinateSymmetryXYZ, BFieldSI2CLHEP<FieldSymmetryXYZ>>>;
 
+/// @brief An axisymmetric magnetic field interpolated from (r, z) data, with
+/// columns r, z, Br, Bphi, Bz by default. See `GridFieldMap3D`.
+template<Concept::MathVector3D T = Eigen::Vector3d,
+         typename AStorage = PrivateFieldMapStorage,
+         muc::ceta_string APrecision = "Double">
+using MagneticFieldMapAxisymmetry = MagneticFieldMap<
+    GridFieldMap3D<T, CoordinateAxisymmetry, BFieldSI2CLHEP<FieldAxisymmetry>, AStorage, APrecision>>;
+
+/// @brief A magnetic field interpolated from data. Processes on the same node
+/// share a single copy of the field map. See `SharedFieldMapStorage`.
+/// @tparam APrecision Precision of stored field values. See `GridFieldMap3D`.
+template<Concept::MathVector3D T = Eigen::Vector3d, muc::ceta_string APrecision = "Double">
+using SharedMagneticFieldMap = MagneticFieldMap<
+    GridFieldMap3D<T, muc::multidentity, BFieldSI2CLHEP<>, SharedFieldMapStorage, APrecision>>;
+
+/// @brief A magnetic field interpolated from data stored in an adaptive
+/// octree, constructed with (file name, tree name, tolerance in tesla).
+/// See `OctreeFieldMap3D`.
+template<Concept::MathVector3D T = Eigen::Vector3d>
+using MagneticFieldMapOctree = MagneticFieldMap<
+    OctreeFieldMap3D<T, muc::multidentity, BFieldSI2CLHEP<>>>;
+
 } // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/MagneticFieldMap.inl"
@@ -0,0 +1,142 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/PrivateFieldMapStorage.h++"
+#include "Mustard/Detector/Field/internal/FieldMapGrid.h++"
+#include "Mustard/Detector/Field/internal/Trilinear.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+#include "Mustard/gslx/index_sequence.h++"
+
+#include "EFM/FieldMap3D.h++"
+
+#include "muc/ceta_string"
+#include "muc/functional"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief A field map stored in an adaptive octree, built from a
+/// `GridFieldMap3D` under a given tolerance. Can be used as the `AFieldMap` of
+/// `MagneticFieldMap`, `ElectricFieldMap` and `ElectromagneticFieldMap`.
+/// @details Starting from the whole grid, a box of grid points is split at
+/// its middle grid planes until trilinear interpolation from the box corners
+/// reproduces every grid point inside within the tolerance. Smooth regions end
+/// up in a few large leaves while regions near magnets keep the grid
+/// resolution. A lookup descends the tree from the root, i.e. costs O(depth).
+/// Neighbouring leaves share corners, so each distinct grid point used as a
+/// corner is stored once and leaves hold indices of their 8 corners.
+/// @tparam T Field value type.
+/// @tparam ACoordinateTransformation See `GridFieldMap3D`.
+/// @tparam AFieldTransformation See `GridFieldMap3D`.
+/// @note Leaves are the cells of the field map: they work with the cell cache
+/// of `ElectromagneticFieldMap<"WithCache">`.
+template<typename T,
+         typename ACoordinateTransformation = muc::multidentity,
+         typename AFieldTransformation = EFM::Identity>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+class OctreeFieldMap3D {
+public:
+    using ValueType = T;
+    using CoordinateType = double;
+
+    static constexpr std::size_t NComponent{sizeof(T) / sizeof(double)};
+
+    /// @brief A point located in the tree: index of the leaf and local
+    /// coordinates of the point in it, each in [0, 1].
+    struct CellPosition {
+        std::size_t cell;
+        std::array<double, 3> t;
+    };
+    /// @brief Field values on the 8 corners of a leaf.
+    using CellValue = std::array<double, 8 * NComponent>;
+
+public:
+    /// @brief Build from a grid field map.
+    /// @param grid The grid field map. Not referenced after construction.
+    /// @param tolerance Maximum absolute deviation of any field component from
+    /// the grid values, in units of stored values (i.e. before field
+    /// transformation, e.g. tesla for `BFieldSI2CLHEP`).
+    template<typename AStorage, muc::ceta_string APrecision>
+    OctreeFieldMap3D(const GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>& grid,
+                     double tolerance);
+    /// @brief Read a grid field map from a ROOT file and build from it.
+    /// See `GridFieldMap3D` for the file format.
+    OctreeFieldMap3D(const std::filesystem::path& fileName, const std::string& treeName, double tolerance,
+                     const std::array<std::string, 3 + NComponent>& columnName =
+                         GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::DefaultColumnName());
+
+    MUSTARD_ALWAYS_INLINE auto operator()(double x, double y, double z) const -> T;
+
+    /// @brief Locate the leaf containing (x, y, z).
+    MUSTARD_ALWAYS_INLINE auto Locate(double x, double y, double z) const -> CellPosition;
+    /// @brief Fetch field values on the corners of a leaf.
+    MUSTARD_ALWAYS_INLINE auto Corner(std::size_t cell) const -> CellValue;
+    /// @brief Evaluate field at (x, y, z) from corner values of the leaf
+    /// containing it.
+    MUSTARD_ALWAYS_INLINE auto operator()(double x, double y, double z, const CellValue& corner, const std::array<double, 3>& t) const -> T;
+
+    auto Grid() const -> const auto& { return fGrid; }
+    auto NNode() const -> auto { return fNode.size(); }
+    auto NLeaf() const -> auto { return fLeafCorner.size() / 8; }
+    auto NVertex() const -> auto { return fVertexValue.size() / NComponent; }
+    auto Depth() const -> auto { return fDepth; }
+
+private:
+    /// @brief A box of grid points [lower, upper]. Boxes wider than one cell
+    /// along an axis are split at (lower + upper) / 2 along it.
+    struct Node {
+        std::array<std::int32_t, 3> lower;
+        std::array<std::int32_t, 3> upper;
+        /// @brief Index of the first child, or of the leaf if `leaf`.
+        std::uint32_t next;
+        bool leaf;
+    };
+
+private:
+    template<typename AGridFieldMap>
+    auto Build(const AGridFieldMap& grid, double tolerance) -> void;
+
+private:
+    [[no_unique_address]] ACoordinateTransformation fCoordinateTransformation;
+    [[no_unique_address]] AFieldTransformation fFieldTransformation;
+    internal::FieldMapGrid fGrid;
+    std::array<double, 3> fInverseDelta;
+    std::vector<Node> fNode;
+    std::vector<std::uint32_t> fLeafCorner;
+    std::vector<double> fVertexValue;
+    int fDepth;
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/OctreeFieldMap3D.inl"
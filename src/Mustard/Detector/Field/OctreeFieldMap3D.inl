@@ -0,0 +1,197 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Detector::Field {
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+template<typename AStorage, muc::ceta_string APrecision>
+OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::OctreeFieldMap3D(
+    const GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation, AStorage, APrecision>& grid,
+    double tolerance) :
+    fCoordinateTransformation{},
+    fFieldTransformation{},
+    fGrid{},
+    fInverseDelta{},
+    fNode{},
+    fLeafCorner{},
+    fVertexValue{},
+    fDepth{} {
+    Build(grid, tolerance);
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::OctreeFieldMap3D(
+    const std::filesystem::path& fileName, const std::string& treeName, double tolerance,
+    const std::array<std::string, 3 + NComponent>& columnName) :
+    OctreeFieldMap3D{GridFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>{fileName, treeName, columnName},
+                     tolerance} {}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::operator()(double x, double y, double z) const -> T {
+    const auto [cell, t]{Locate(x, y, z)};
+    return (*this)(x, y, z, Corner(cell), t);
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::Locate(double x, double y, double z) const -> CellPosition {
+    const auto [u, v, w]{fCoordinateTransformation(x, y, z)};
+    const std::array c{u, v, w};
+    std::array<double, 3> s;
+    for (int d{}; d < 3; ++d) {
+        s[d] = std::clamp((c[d] - fGrid.min[d]) * fInverseDelta[d], 0., fGrid.n[d] - 1.);
+    }
+    auto node{&fNode.front()};
+    while (not node->leaf) {
+        std::size_t child{};
+        for (int d{}; d < 3; ++d) {
+            if (node->upper[d] - node->lower[d] > 1) {
+                child = 2 * child + (s[d] >= (node->lower[d] + node->upper[d]) / 2);
+            }
+        }
+        node = &fNode[node->next + child];
+    }
+    CellPosition position;
+    position.cell = node->next;
+    for (int d{}; d < 3; ++d) {
+        const auto extent{node->upper[d] - node->lower[d]};
+        position.t[d] = extent == 0 ? 0 : (s[d] - node->lower[d]) / extent;
+    }
+    return position;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::Corner(std::size_t cell) const -> CellValue {
+    const auto vertex{fLeafCorner.data() + cell * 8};
+    CellValue corner;
+    for (int i{}; i < 8; ++i) {
+        std::ranges::copy_n(fVertexValue.data() + vertex[i] * NComponent, NComponent, corner.begin() + i * NComponent);
+    }
+    return corner;
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+auto OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::operator()(double x, double y, double z, const CellValue& corner, const std::array<double, 3>& t) const -> T {
+    const auto f{internal::Trilinear<NComponent>(corner, t)};
+    return fFieldTransformation(x, y, z, [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return T{f[Is]...};
+    }(gslx::make_index_sequence<NComponent>{}));
+}
+
+template<typename T, typename ACoordinateTransformation, typename AFieldTransformation>
+    requires Concept::NumericVector<T, double, 3> or Concept::NumericVector<T, double, 6>
+template<typename AGridFieldMap>
+auto OctreeFieldMap3D<T, ACoordinateTransformation, AFieldTransformation>::Build(const AGridFieldMap& grid, double tolerance) -> void {
+    Expects(tolerance >= 0);
+    fGrid = grid.Grid();
+    for (int d{}; d < 3; ++d) {
+        fInverseDelta[d] = 1 / fGrid.delta[d];
+    }
+
+    // grid point index -> vertex index, so that leaves share their corners
+    std::unordered_map<std::size_t, std::uint32_t> vertexIndex;
+    const auto Vertex{[&](int i, int j, int k) {
+        const auto point{(static_cast<std::size_t>(i) * fGrid.n[1] + j) * fGrid.n[2] + k};
+        const auto [it, inserted]{vertexIndex.try_emplace(point, NVertex())};
+        if (inserted) {
+            const auto v{grid.Value(i, j, k)};
+            fVertexValue.insert(fVertexValue.end(), v.begin(), v.end());
+        }
+        return it->second;
+    }};
+
+    // boxes are processed breadth-first, so that children of a node are contiguous
+    fNode.push_back({{0, 0, 0}, {fGrid.n[0] - 1, fGrid.n[1] - 1, fGrid.n[2] - 1}, 0, false});
+    std::vector<int> level{0};
+    for (std::size_t p{}; p < fNode.size(); ++p) {
+        const auto lower{fNode[p].lower};
+        const auto upper{fNode[p].upper};
+
+        CellValue corner;
+        for (int i{}; i < 8; ++i) {
+            const auto v{grid.Value(i & 4 ? upper[0] : lower[0], i & 2 ? upper[1] : lower[1], i & 1 ? upper[2] : lower[2])};
+            std::ranges::copy(v, corner.begin() + i * NComponent);
+        }
+        const auto local{[&](int i, int d) {
+            return upper[d] == lower[d] ? 0. : static_cast<double>(i - lower[d]) / (upper[d] - lower[d]);
+        }};
+        const auto accurate{[&] {
+            std::array<double, 3> t;
+            for (auto i{lower[0]}; i <= upper[0]; ++i) {
+                t[0] = local(i, 0);
+                for (auto j{lower[1]}; j <= upper[1]; ++j) {
+                    t[1] = local(j, 1);
+                    for (auto k{lower[2]}; k <= upper[2]; ++k) {
+                        t[2] = local(k, 2);
+                        const auto f{internal::Trilinear<NComponent>(corner, t)};
+                        const auto v{grid.Value(i, j, k)};
+                        for (std::size_t c{}; c < NComponent; ++c) {
+                            if (not(std::abs(f[c] - v[c]) <= tolerance)) { return false; }
+                        }
+                    }
+                }
+            }
+            return true;
+        }};
+
+        const auto divisible{upper[0] - lower[0] > 1 or upper[1] - lower[1] > 1 or upper[2] - lower[2] > 1};
+        if (not divisible or accurate()) {
+            fNode[p].leaf = true;
+            fNode[p].next = NLeaf();
+            for (int i{}; i < 8; ++i) {
+                fLeafCorner.push_back(Vertex(i & 4 ? upper[0] : lower[0], i & 2 ? upper[1] : lower[1], i & 1 ? upper[2] : lower[2]));
+            }
+            continue;
+        }
+
+        std::array<int, 3> nHalf;
+        std::array<std::array<std::array<std::int32_t, 2>, 2>, 3> half;
+        for (int d{}; d < 3; ++d) {
+            if (const auto mid{(lower[d] + upper[d]) / 2};
+                upper[d] - lower[d] > 1) {
+                nHalf[d] = 2;
+                half[d] = {{{lower[d], mid}, {mid, upper[d]}}};
+            } else {
+                nHalf[d] = 1;
+                half[d][0] = {lower[d], upper[d]};
+            }
+        }
+        fNode[p].next = fNode.size();
+        for (int a{}; a < nHalf[0]; ++a) {
+            for (int b{}; b < nHalf[1]; ++b) {
+                for (int c{}; c < nHalf[2]; ++c) {
+                    fNode.push_back({{half[0][a][0], half[1][b][0], half[2][c][0]},
+                                     {half[0][a][1], half[1][b][1], half[2][c][1]},
+                                     0, false});
+                    level.push_back(level[p] + 1);
+                }
+            }
+        }
+    }
+    fDepth = std::ranges::max(level);
+    fNode.shrink_to_fit();
+    fLeafCorner.shrink_to_fit();
+    fVertexValue.shrink_to_fit();
+}
+
+} // namespace Mustard::Detector::Field
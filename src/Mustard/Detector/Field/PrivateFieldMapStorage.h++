@@ -0,0 +1,81 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Detector/Field/internal/MappedFile.h++"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief Field map storage owned by each process. Every process reads the
+/// field map by itself and holds its own copy.
+/// @see SharedFieldMapStorage
+class PrivateFieldMapStorage {
+public:
+    PrivateFieldMapStorage();
+
+    /// @brief Whether this process is responsible for filling the storage.
+    auto Leader() const -> bool { return true; }
+    /// @brief Share a trivially copyable object from the leader.
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    auto Broadcast(T&) const -> void {}
+    /// @brief Allocate `size` bytes. The returned buffer should be filled by the leader.
+    auto Allocate(std::size_t size) -> std::span<std::byte>;
+    /// @brief Make the filled buffer visible to all processes sharing the storage.
+    auto Publish() -> void {}
+    /// @brief Use data in a file from `offset` on, mapped read-only into memory.
+    auto Map(const std::filesystem::path& path, std::size_t offset) -> void;
+    /// @brief The whole mapped file, empty if nothing is mapped.
+    auto Mapped() const -> std::span<const std::byte> { return {fMappedFile.Data(), fMappedFile.Size()}; }
+    /// @brief Whether `value` is true on all processes sharing the storage.
+    auto AllOf(bool value) const -> bool { return value; }
+    /// @brief Published data.
+    auto Data() const -> const std::byte* { return fData; }
+
+private:
+    std::vector<std::byte> fBuffer;
+    internal::MappedFile fMappedFile;
+    const std::byte* fData;
+};
+
+inline PrivateFieldMapStorage::PrivateFieldMapStorage() :
+    fBuffer{},
+    fMappedFile{},
+    fData{} {}
+
+inline auto PrivateFieldMapStorage::Allocate(std::size_t size) -> std::span<std::byte> {
+    fMappedFile = {};
+    fBuffer.assign(size, {});
+    fData = fBuffer.data();
+    return fBuffer;
+}
+
+inline auto PrivateFieldMapStorage::Map(const std::filesystem::path& path, std::size_t offset) -> void {
+    fBuffer = {};
+    fMappedFile = internal::MappedFile{path};
+    fData = fMappedFile.Data() + offset;
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,91 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/SharedFieldMapStorage.h++"
+
+#include "mplr/mplr.hpp"
+
+namespace Mustard::Detector::Field {
+
+SharedFieldMapStorage::SharedFieldMapStorage() :
+    NonCopyableBase{},
+    fIntraNodeComm{},
+    fWindow{MPI_WIN_NULL},
+    fData{},
+    fPrivateData{},
+    fMappedFile{} {
+    if (mplr::available() and Env::MPIEnv::Available()) {
+        fIntraNodeComm = &Env::MPIEnv::Instance().IntraNodeComm();
+    }
+}
+
+SharedFieldMapStorage::~SharedFieldMapStorage() {
+    if (fWindow != MPI_WIN_NULL) {
+        MPI_Win_free(&fWindow);
+    }
+}
+
+auto SharedFieldMapStorage::Allocate(std::size_t size) -> std::span<std::byte> {
+    fMappedFile = {};
+    if (fIntraNodeComm == nullptr) {
+        fPrivateData.resize(size);
+        fData = fPrivateData.data();
+        return fPrivateData;
+    }
+    if (fWindow != MPI_WIN_NULL) {
+        MPI_Win_free(&fWindow);
+    }
+    std::byte* data;
+    MPI_Win_allocate_shared(Leader() ? size : 0, 1, MPI_INFO_NULL,
+                            fIntraNodeComm->native_handle(), &data, &fWindow);
+    if (not Leader()) {
+        MPI_Aint leaderSize;
+        int dispUnit;
+        MPI_Win_shared_query(fWindow, 0, &leaderSize, &dispUnit, &data);
+    }
+    fData = data;
+    return {data, size};
+}
+
+auto SharedFieldMapStorage::Publish() -> void {
+    if (fWindow == MPI_WIN_NULL) {
+        return;
+    }
+    // make stores of the leader visible to all processes on the node
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, fWindow);
+    MPI_Win_sync(fWindow);
+    fIntraNodeComm->ibarrier().wait(mplr::duty_ratio::preset::moderate);
+    MPI_Win_sync(fWindow);
+    MPI_Win_unlock_all(fWindow);
+}
+
+auto SharedFieldMapStorage::Map(const std::filesystem::path& path, std::size_t offset) -> void {
+    fMappedFile = internal::MappedFile{path};
+    fData = fMappedFile.Data() + offset;
+}
+
+auto SharedFieldMapStorage::AllOf(bool value) const -> bool {
+    if (fIntraNodeComm == nullptr) {
+        return value;
+    }
+    int all{value};
+    fIntraNodeComm->allreduce(mplr::min<int>{}, all);
+    return all;
+}
+
+} // namespace Mustard::Detector::Field
@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Detector/Field/internal/MappedFile.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Utility/NonCopyableBase.h++"
+
+#include "mpi.h"
+
+#include "mplr/mplr.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Mustard::Detector::Field {
+
+/// @brief Field map storage shared by all processes on the same node.
+/// Only the node leader (rank 0 of the intra-node communicator) reads the
+/// field map, into an MPI-3 shared memory window. Other processes on the
+/// node map the same window, so a node holds a single copy of the field
+/// map regardless of the number of processes on it.
+/// @note Construction, allocation, publication and destruction are collective
+/// over the intra-node communicator, since (re)allocation and destruction free
+/// the shared memory window with MPI_Win_free. Thus, all processes on the node
+/// must allocate and destroy the storage together, and before MPI_Finalize.
+/// Falls back to private storage if MPI environment is not available.
+/// @see PrivateFieldMapStorage
+class SharedFieldMapStorage : public NonCopyableBase {
+public:
+    SharedFieldMapStorage();
+    ~SharedFieldMapStorage();
+
+    /// @brief Whether this process is responsible for filling the storage.
+    auto Leader() const -> bool { return fIntraNodeComm == nullptr or fIntraNodeComm->rank() == 0; }
+    /// @brief Share a trivially copyable object from the node leader.
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    auto Broadcast(T& object) const -> void;
+    /// @brief Allocate `size` bytes. The returned buffer should be filled by the leader.
+    auto Allocate(std::size_t size) -> std::span<std::byte>;
+    /// @brief Make the filled buffer visible to all processes on the node.
+    auto Publish() -> void;
+    /// @brief Use data in a file from `offset` on, mapped read-only into memory.
+    /// Mapped pages are shared by all processes on the node through the page cache.
+    auto Map(const std::filesystem::path& path, std::size_t offset) -> void;
+    /// @brief The whole mapped file, empty if nothing is mapped.
+    auto Mapped() const -> std::span<const std::byte> { return {fMappedFile.Data(), fMappedFile.Size()}; }
+    /// @brief Whether `value` is true on all processes on the node.
+    auto AllOf(bool value) const -> bool;
+    /// @brief Published data.
+    auto Data() const -> const std::byte* { return fData; }
+
+private:
+    const mplr::communicator* fIntraNodeComm;
+    MPI_Win fWindow;
+    std::byte* fData;
+    std::vector<std::byte> fPrivateData;
+    internal::MappedFile fMappedFile;
+};
+
+} // namespace Mustard::Detector::Field
+
+#include "Mustard/Detector/Field/SharedFieldMapStorage.inl"
@@ -0,0 +1,156 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Eigen/Core"
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief A field map able to evaluate from corner values of a grid cell,
+/// e.g. `GridFieldMap3D`.
+template<typename AFieldMap>
+concept CellwiseFieldMap =
+    requires(const AFieldMap& map, double x, const typename AFieldMap::CellValue& corner) {
+        { map.Locate(x, x, x).cell } -> std::convertible_to<std::size_t>;
+        { map.Corner(std::size_t{}) } -> std::same_as<typename AFieldMap::CellValue>;
+        map(x, x, x, corner, map.Locate(x, x, x).t);
+    };
+
+/// @brief ID identifying a field object in thread-local caches.
+/// IDs are never reused, so a cache never serves a destroyed field object.
+/// A copied or assigned field object gets a new ID, as its content may differ
+/// from what the caches hold for the old one.
+class FieldCacheOwner {
+public:
+    FieldCacheOwner() :
+        fID{NewID()} {}
+    FieldCacheOwner(const FieldCacheOwner&) :
+        fID{NewID()} {}
+    auto operator=(const FieldCacheOwner&) -> FieldCacheOwner& { return fID = NewID(), *this; }
+
+    auto ID() const -> auto { return fID; }
+
+private:
+    static auto NewID() -> std::uint64_t {
+        static std::atomic<std::uint64_t> counter{1};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    std::uint64_t fID;
+};
+
+/// @brief Caches of the few most recently used field objects, one per object.
+/// Objects used alternately in a thread (e.g. two fields of the same type)
+/// keep their own cache instead of evicting each other's.
+template<typename ACache, int NOwner>
+class FieldCacheSet {
+public:
+    auto operator[](const FieldCacheOwner& owner) -> ACache& {
+        ++fTick;
+        auto* leastRecent{&fSlot.front()};
+        for (auto&& slot : fSlot) {
+            if (slot.owner == owner.ID()) {
+                slot.lastUse = fTick;
+                return slot.cache;
+            }
+            if (slot.lastUse < leastRecent->lastUse) {
+                leastRecent = &slot;
+            }
+        }
+        leastRecent->owner = owner.ID();
+        leastRecent->lastUse = fTick;
+        leastRecent->cache = {};
+        return leastRecent->cache;
+    }
+
+private:
+    struct Slot {
+        std::uint64_t owner; ///< 0 for empty slot
+        std::uint64_t lastUse;
+        ACache cache;
+    };
+
+private:
+    std::uint64_t fTick{};
+    std::array<Slot, NOwner> fSlot{};
+};
+
+/// @brief Caches field value at the last evaluated point.
+template<typename AValue>
+class PointFieldCache {
+public:
+    template<std::invocable<> AEvaluate>
+    auto Get(const Eigen::Vector3d& x, AEvaluate&& Evaluate) -> const AValue& {
+        if (not fValid or x != fX) {
+            fValid = true;
+            fX = x;
+            fValue = Evaluate();
+        }
+        return fValue;
+    }
+
+private:
+    bool fValid{};
+    Eigen::Vector3d fX;
+    AValue fValue;
+};
+
+/// @brief Least-recently-used cache of grid cell corner values.
+template<typename ACellValue, int N>
+class CellFieldCache {
+public:
+    template<std::invocable<std::size_t> AFetch>
+    auto Get(std::size_t cell, AFetch&& Fetch) -> const ACellValue& {
+        ++fTick;
+        auto* leastRecent{&fEntry.front()};
+        for (auto&& entry : fEntry) {
+            if (entry.lastUse != 0 and entry.cell == cell) {
+                entry.lastUse = fTick;
+                return entry.value;
+            }
+            if (entry.lastUse < leastRecent->lastUse) {
+                leastRecent = &entry;
+            }
+        }
+        leastRecent->cell = cell;
+        leastRecent->lastUse = fTick;
+        leastRecent->value = Fetch(cell);
+        return leastRecent->value;
+    }
+
+private:
+    struct Entry {
+        std::size_t cell;
+        std::uint64_t lastUse; ///< 0 for empty entry
+        ACellValue value;
+    };
+
+private:
+    std::uint64_t fTick{};
+    std::array<Entry, N> fEntry{};
+};
+
+} // namespace Mustard::Detector::Field::internal
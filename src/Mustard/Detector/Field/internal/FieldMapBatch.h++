@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief A field map able to evaluate many points at once in SoA layout,
+/// e.g. `GridFieldMap3D`.
+template<typename AFieldMap>
+concept SoAFieldMap =
+    requires(const AFieldMap& map, std::span<const double> x, const std::array<std::span<double>, AFieldMap::NComponent>& f) {
+        map(x, x, x, f);
+    };
+
+/// @brief Evaluate a field map at points in AoS layout through its SoA
+/// interface, block by block without heap allocation.
+/// @param Store Called as `Store(i, f)` with point index and field value
+/// components `f` (a `std::array<double, NComponent>`).
+template<SoAFieldMap AFieldMap, Concept::NumericVector3D T, typename AStore>
+auto EvaluateSoA(const AFieldMap& map, std::span<const T> x, AStore&& Store) -> void {
+    constexpr auto nComponent{AFieldMap::NComponent};
+    constexpr std::size_t blockSize{256};
+    std::array<std::array<double, blockSize>, 3> xBlock;
+    std::array<std::array<double, blockSize>, nComponent> fBlock;
+    for (std::size_t begin{}; begin < x.size(); begin += blockSize) {
+        const auto m{std::min(blockSize, x.size() - begin)};
+        for (std::size_t i{}; i < m; ++i) {
+            xBlock[0][i] = x[begin + i][0];
+            xBlock[1][i] = x[begin + i][1];
+            xBlock[2][i] = x[begin + i][2];
+        }
+        std::array<std::span<double>, nComponent> f;
+        for (std::size_t k{}; k < nComponent; ++k) {
+            f[k] = {fBlock[k].data(), m};
+        }
+        map(std::span<const double>{xBlock[0].data(), m},
+            std::span<const double>{xBlock[1].data(), m},
+            std::span<const double>{xBlock[2].data(), m}, f);
+        for (std::size_t i{}; i < m; ++i) {
+            std::array<double, nComponent> fi;
+            for (std::size_t k{}; k < nComponent; ++k) {
+                fi[k] = fBlock[k][i];
+            }
+            Store(begin + i, fi);
+        }
+    }
+}
+
+} // namespace Mustard::Detector::Field::internal
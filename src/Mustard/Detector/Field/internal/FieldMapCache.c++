@@ -0,0 +1,167 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/internal/FieldMapCache.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/core.h"
+#include "fmt/std.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace Mustard::Detector::Field::internal {
+
+namespace {
+
+constexpr std::array<char, 8> gMagic{'M', 'S', 'T', 'D', 'F', 'M', 'A', 'P'};
+constexpr std::uint32_t gVersion{2};
+constexpr std::size_t gDataAlignment{4096};
+
+struct CacheHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t signatureSize;
+    std::uint64_t sourceSize;
+    std::int64_t sourceTime;
+    std::array<double, 3> min;
+    std::array<double, 3> delta;
+    std::array<std::int32_t, 3> n;
+    std::int32_t reserved;
+    std::uint64_t dataOffset;
+    std::uint64_t dataSize;
+};
+
+auto SourceTime(const std::filesystem::path& sourcePath) -> std::int64_t {
+    return std::filesystem::last_write_time(sourcePath).time_since_epoch().count();
+}
+
+// 64-bit FNV-1a, stable across builds and platforms
+auto SignatureHash(std::string_view signature) -> std::uint64_t {
+    std::uint64_t hash{0xcbf29ce484222325};
+    for (auto&& c : signature) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+} // namespace
+
+auto FieldMapCachePath(const std::filesystem::path& fileName, const std::string& treeName,
+                       std::string_view signature) -> std::filesystem::path {
+    auto cachePath{fileName};
+    cachePath += fmt::format(".{}.{:016x}.fieldmap", treeName, SignatureHash(signature));
+    return cachePath;
+}
+
+auto ReadFieldMapCache(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath,
+                       std::string_view signature) -> std::optional<FieldMapCacheInfo> {
+    std::ifstream cache{cachePath, std::ios::binary};
+    if (not cache.is_open()) {
+        return std::nullopt;
+    }
+    CacheHeader header;
+    if (not cache.read(reinterpret_cast<char*>(&header), sizeof(CacheHeader)) or
+        header.magic != gMagic or header.version != gVersion) {
+        PrintWarning(fmt::format("Field map cache '{}' is of unknown format and will be rebuilt", cachePath));
+        return std::nullopt;
+    }
+    std::string storedSignature(header.signatureSize, '\0');
+    cache.read(storedSignature.data(), storedSignature.size());
+    std::error_code ec;
+    const auto sourceSize{std::filesystem::file_size(sourcePath, ec)};
+    if (ec or header.sourceSize != sourceSize or header.sourceTime != SourceTime(sourcePath) or
+        storedSignature != signature) {
+        PrintWarning(fmt::format("Field map cache '{}' is outdated and will be rebuilt", cachePath));
+        return std::nullopt;
+    }
+    if (std::filesystem::file_size(cachePath) != header.dataOffset + header.dataSize) {
+        PrintWarning(fmt::format("Field map cache '{}' is corrupted and will be rebuilt", cachePath));
+        return std::nullopt;
+    }
+    return FieldMapCacheInfo{{header.min, header.delta, header.n}, header.dataOffset, header.dataSize};
+}
+
+auto CheckMappedFieldMapCache(std::span<const std::byte> mapped, std::string_view signature,
+                              const FieldMapCacheInfo& info) -> bool {
+    if (mapped.size() < sizeof(CacheHeader) + signature.size()) {
+        return false;
+    }
+    CacheHeader header;
+    std::memcpy(&header, mapped.data(), sizeof(CacheHeader));
+    if (header.magic != gMagic or header.version != gVersion or header.signatureSize != signature.size()) {
+        return false;
+    }
+    const std::string_view storedSignature{reinterpret_cast<const char*>(mapped.data()) + sizeof(CacheHeader), signature.size()};
+    return storedSignature == signature and
+           header.min == info.grid.min and header.delta == info.grid.delta and header.n == info.grid.n and
+           header.dataOffset == info.dataOffset and header.dataSize == info.dataSize and
+           mapped.size() == header.dataOffset + header.dataSize;
+}
+
+auto WriteFieldMapCache(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath,
+                        std::string_view signature, const FieldMapGrid& grid, std::span<const std::byte> data) -> void {
+    // one writer per node is enough
+    if (mplr::available() and Env::MPIEnv::Available() and
+        Env::MPIEnv::Instance().IntraNodeComm().rank() != 0) {
+        return;
+    }
+    auto temporaryPath{cachePath};
+    temporaryPath += fmt::format(".{:x}.{:x}.tmp",
+                                 mplr::available() ? mplr::comm_world().rank() : 0, std::random_device{}());
+    try {
+        CacheHeader header{};
+        header.magic = gMagic;
+        header.version = gVersion;
+        header.signatureSize = signature.size();
+        header.sourceSize = std::filesystem::file_size(sourcePath);
+        header.sourceTime = SourceTime(sourcePath);
+        header.min = grid.min;
+        header.delta = grid.delta;
+        header.n = grid.n;
+        header.dataOffset = (sizeof(CacheHeader) + signature.size() + gDataAlignment - 1) / gDataAlignment * gDataAlignment;
+        header.dataSize = data.size();
+        {
+            std::ofstream cache{temporaryPath, std::ios::binary | std::ios::trunc};
+            cache.exceptions(std::ios::failbit | std::ios::badbit);
+            cache.write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+            cache.write(signature.data(), signature.size());
+            const std::string padding(header.dataOffset - sizeof(CacheHeader) - signature.size(), '\0');
+            cache.write(padding.data(), padding.size());
+            cache.write(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+        std::filesystem::rename(temporaryPath, cachePath);
+    } catch (const std::exception& e) {
+        std::error_code muteRemoveError;
+        std::filesystem::remove(temporaryPath, muteRemoveError);
+        PrintWarning(fmt::format("Field map cache cannot be saved to '{}' ({})", cachePath, e.what()));
+    }
+}
+
+} // namespace Mustard::Detector::Field::internal
@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Detector/Field/internal/FieldMapGrid.h++"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief Layout of a valid field map cache.
+struct FieldMapCacheInfo {
+    FieldMapGrid grid;      ///< Grid geometry
+    std::size_t dataOffset; ///< Byte offset of grid values in the cache file
+    std::size_t dataSize;   ///< Size of grid values in bytes
+};
+
+/// @brief Binary field map cache file path of a field map. The cache sits
+/// beside the source file. A hash of the signature is part of the file name,
+/// so maps of different precision or symmetry over the same source keep
+/// separate caches.
+auto FieldMapCachePath(const std::filesystem::path& fileName, const std::string& treeName,
+                       std::string_view signature) -> std::filesystem::path;
+
+/// @brief Validate a field map cache against its source.
+/// @param signature Describes how values are stored, e.g. column names,
+/// precision and transformations. A cache with a different signature is
+/// considered stale.
+/// @return Cache layout, or `std::nullopt` if the cache does not exist or is
+/// outdated, corrupted or of a different format version.
+auto ReadFieldMapCache(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath,
+                       std::string_view signature) -> std::optional<FieldMapCacheInfo>;
+
+/// @brief Check a mapped field map cache against the layout validated by
+/// ReadFieldMapCache. The cache can be replaced between validation and
+/// mapping, so each process mapping it should check the mapped region itself.
+/// @return Whether the mapped region has the expected magic, version,
+/// signature, grid and size.
+auto CheckMappedFieldMapCache(std::span<const std::byte> mapped, std::string_view signature,
+                              const FieldMapCacheInfo& info) -> bool;
+
+/// @brief Write a field map cache. The cache is written to a temporary file
+/// and then renamed, so concurrent readers never see a partial cache. Only
+/// one process per node writes. Failure to write the cache is reported as a warning.
+auto WriteFieldMapCache(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath,
+                        std::string_view signature, const FieldMapGrid& grid, std::span<const std::byte> data) -> void;
+
+} // namespace Mustard::Detector::Field::internal
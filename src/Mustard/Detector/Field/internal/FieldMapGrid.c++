@@ -0,0 +1,173 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/internal/FieldMapGrid.h++"
+#include "Mustard/IO/File.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderValue.h"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "fmt/core.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Mustard::Detector::Field::internal {
+
+namespace {
+
+auto GetFieldMapTree(File<TFile>& file, const std::string& treeName) -> TTree& {
+    const auto tree{file->Get<TTree>(treeName.c_str())};
+    if (tree == nullptr) {
+        Throw<std::runtime_error>(fmt::format("Field map '{}' not found in '{}'", treeName, file.Path()));
+    }
+    return *tree;
+}
+
+auto CheckReaderStatus(const TTreeReader& reader, const std::filesystem::path& fileName) -> void {
+    if (reader.GetEntryStatus() != TTreeReader::kEntryBeyondEnd) {
+        Throw<std::runtime_error>(fmt::format("Error reading field map from '{}' (entry status {})",
+                                              fileName, static_cast<int>(reader.GetEntryStatus())));
+    }
+}
+
+// Readers of coordinate columns, null for a degenerate axis
+auto MakeCoordinateReader(TTreeReader& reader, const std::array<std::string, 3>& coordinateName) {
+    std::array<std::unique_ptr<TTreeReaderValue<double>>, 3> x;
+    for (int i{}; i < 3; ++i) {
+        if (not coordinateName[i].empty()) {
+            x[i] = std::make_unique<TTreeReaderValue<double>>(reader, coordinateName[i].c_str());
+        }
+    }
+    return x;
+}
+
+} // namespace
+
+auto ScanFieldMapGrid(const std::filesystem::path& fileName, const std::string& treeName,
+                      const std::array<std::string, 3>& coordinateName) -> FieldMapGrid {
+    File<TFile> file{fileName};
+    TTreeReader reader{&GetFieldMapTree(file, treeName)};
+    const auto x{MakeCoordinateReader(reader, coordinateName)};
+
+    const auto nEntry{reader.GetEntries()};
+    std::array<std::vector<double>, 3> coordinate;
+    for (int i{}; i < 3; ++i) {
+        if (x[i]) {
+            coordinate[i].reserve(nEntry);
+        }
+    }
+    while (reader.Next()) {
+        for (int i{}; i < 3; ++i) {
+            if (x[i]) {
+                coordinate[i].emplace_back(**x[i]);
+            }
+        }
+    }
+    CheckReaderStatus(reader, fileName);
+
+    FieldMapGrid grid;
+    for (int i{}; i < 3; ++i) {
+        if (not x[i]) {
+            grid.min[i] = 0;
+            grid.delta[i] = 1;
+            grid.n[i] = 1;
+            continue;
+        }
+        auto& c{coordinate[i]};
+        std::ranges::sort(c);
+        if (c.empty() or c.back() == c.front()) {
+            Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' has less than 2 grid points along {}",
+                                                  treeName, fileName, coordinateName[i]));
+        }
+        // tolerate round-off in stored coordinates
+        const auto tolerance{1e-9 * (c.back() - c.front())};
+        const auto [last, end]{std::ranges::unique(c, [&](auto a, auto b) { return b - a <= tolerance; })};
+        c.erase(last, end);
+        grid.min[i] = c.front();
+        grid.n[i] = c.size();
+        grid.delta[i] = (c.back() - c.front()) / (c.size() - 1);
+        for (gsl::index k{1}; k < std::ssize(c); ++k) {
+            if (muc::abs(c[k] - c[k - 1] - grid.delta[i]) > 1e-6 * grid.delta[i]) {
+                Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' is not uniform along {} (near {} = {})",
+                                                      treeName, fileName, coordinateName[i], coordinateName[i], c[k]));
+            }
+        }
+    }
+    if (static_cast<std::size_t>(nEntry) != grid.NPoint()) {
+        Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' has {} entries but its grid has {} x {} x {} points",
+                                              treeName, fileName, nEntry, grid.n[0], grid.n[1], grid.n[2]));
+    }
+    return grid;
+}
+
+auto ReadFieldMapValue(const std::filesystem::path& fileName, const std::string& treeName,
+                       const std::array<std::string, 3>& coordinateName, std::span<const std::string> valueName,
+                       const FieldMapGrid& grid, std::span<double> value) -> void {
+    const auto nComponent{valueName.size()};
+    Expects(value.size() == grid.NPoint() * nComponent);
+
+    File<TFile> file{fileName};
+    TTreeReader reader{&GetFieldMapTree(file, treeName)};
+    const auto x{MakeCoordinateReader(reader, coordinateName)};
+    std::vector<std::unique_ptr<TTreeReaderValue<double>>> f;
+    f.reserve(nComponent);
+    for (auto&& name : valueName) {
+        f.emplace_back(std::make_unique<TTreeReaderValue<double>>(reader, name.c_str()));
+    }
+
+    std::vector<bool> filled(grid.NPoint());
+    std::array<double, 3> point{};
+    while (reader.Next()) {
+        std::size_t index{};
+        for (int i{}; i < 3; ++i) {
+            if (x[i]) {
+                point[i] = **x[i];
+            }
+            const auto k{std::lround((point[i] - grid.min[i]) / grid.delta[i])};
+            if (k < 0 or k >= grid.n[i]) {
+                Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' has a point off the grid ({} = {})",
+                                                      treeName, fileName, coordinateName[i], point[i]));
+            }
+            index = index * grid.n[i] + k;
+        }
+        if (filled[index]) {
+            Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' has duplicated point ({}, {}, {})",
+                                                  treeName, fileName, point[0], point[1], point[2]));
+        }
+        filled[index] = true;
+        for (std::size_t j{}; j < nComponent; ++j) {
+            value[index * nComponent + j] = **f[j];
+        }
+    }
+    CheckReaderStatus(reader, fileName);
+}
+
+} // namespace Mustard::Detector::Field::internal
@@ -0,0 +1,52 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief A uniform rectilinear grid on which a field map is sampled.
+/// Values are stored in row-major (x, y, z, component) order. An axis with a
+/// single grid point is degenerate, e.g. y of an (r, z) map.
+struct FieldMapGrid {
+    std::array<double, 3> min;   ///< Coordinate of the first grid point
+    std::array<double, 3> delta; ///< Grid spacing
+    std::array<int, 3> n;        ///< Number of grid points along each axis
+
+    auto NPoint() const -> std::size_t { return static_cast<std::size_t>(n[0]) * n[1] * n[2]; }
+};
+
+/// @brief Deduce the grid of a field map stored as a ROOT tree.
+/// An empty coordinate name makes a degenerate axis at 0.
+/// Throws if sample points do not form a complete uniform grid.
+auto ScanFieldMapGrid(const std::filesystem::path& fileName, const std::string& treeName,
+                      const std::array<std::string, 3>& coordinateName) -> FieldMapGrid;
+
+/// @brief Read field map values stored as a ROOT tree into `value`.
+/// Columns should be of type double.
+auto ReadFieldMapValue(const std::filesystem::path& fileName, const std::string& treeName,
+                       const std::array<std::string, 3>& coordinateName, std::span<const std::string> valueName,
+                       const FieldMapGrid& grid, std::span<double> value) -> void;
+
+} // namespace Mustard::Detector::Field::internal
@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/internal/FieldSupportIndex.h++"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Mustard::Detector::Field::internal {
+
+FieldSupportIndex::FieldSupportIndex(std::span<const FieldSupport> support, int nCellPerAxis) :
+    fUnbounded{},
+    fMin{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
+    fMax{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()},
+    fInverseCellSize{},
+    fNCellPerAxis{nCellPerAxis},
+    fCell{} {
+    Expects(support.size() <= 64);
+    Expects(nCellPerAxis > 0);
+
+    // index covers bounded supports, unbounded ones are candidates everywhere
+    for (gsl::index i{}; i < std::ssize(support); ++i) {
+        if (not support[i].Bounded()) {
+            fUnbounded |= std::uint64_t{1} << i;
+            continue;
+        }
+        for (int d{}; d < 3; ++d) {
+            fMin[d] = std::min(fMin[d], support[i].min[d]);
+            fMax[d] = std::max(fMax[d], support[i].max[d]);
+        }
+    }
+    if (fMin[0] > fMax[0]) {
+        return;
+    }
+    for (int d{}; d < 3; ++d) {
+        const auto size{fMax[d] - fMin[d]};
+        fInverseCellSize[d] = size > 0 ? fNCellPerAxis / size : 0;
+    }
+
+    fCell.assign(static_cast<std::size_t>(fNCellPerAxis) * fNCellPerAxis * fNCellPerAxis, fUnbounded);
+    const auto CellIndex{[this](double x, int d) {
+        return std::clamp(static_cast<int>((x - fMin[d]) * fInverseCellSize[d]), 0, fNCellPerAxis - 1);
+    }};
+    for (gsl::index i{}; i < std::ssize(support); ++i) {
+        if (not support[i].Bounded()) {
+            continue;
+        }
+        std::array<int, 3> first;
+        std::array<int, 3> last;
+        for (int d{}; d < 3; ++d) {
+            first[d] = CellIndex(support[i].min[d], d);
+            last[d] = CellIndex(support[i].max[d], d);
+        }
+        for (auto a{first[0]}; a <= last[0]; ++a) {
+            for (auto b{first[1]}; b <= last[1]; ++b) {
+                for (auto c{first[2]}; c <= last[2]; ++c) {
+                    fCell[(a * fNCellPerAxis + b) * fNCellPerAxis + c] |= std::uint64_t{1} << i;
+                }
+            }
+        }
+    }
+}
+
+auto FieldSupportIndex::Candidate(const muc::array3d& x) const -> std::uint64_t {
+    // written so that NaN coordinates fall outside, before being cast to int
+    if (fCell.empty() or
+        not(fMin[0] <= x[0] and x[0] <= fMax[0] and
+            fMin[1] <= x[1] and x[1] <= fMax[1] and
+            fMin[2] <= x[2] and x[2] <= fMax[2])) {
+        return fUnbounded;
+    }
+    std::size_t cell{};
+    for (int d{}; d < 3; ++d) {
+        cell = cell * fNCellPerAxis + std::min(static_cast<int>((x[d] - fMin[d]) * fInverseCellSize[d]), fNCellPerAxis - 1);
+    }
+    return fCell[cell];
+}
+
+} // namespace Mustard::Detector::Field::internal
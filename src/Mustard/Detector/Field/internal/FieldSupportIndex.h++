@@ -0,0 +1,52 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Detector/Field/FieldSupport.h++"
+
+#include "muc/array"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief A uniform grid index over field supports. Each grid cell records
+/// the fields whose support overlaps the cell as a bit mask.
+class FieldSupportIndex {
+public:
+    /// @param support Supports of at most 64 fields.
+    /// @param nCellPerAxis Index resolution along each axis.
+    explicit FieldSupportIndex(std::span<const FieldSupport> support, int nCellPerAxis = 16);
+
+    /// @brief Fields possibly non-zero at x.
+    auto Candidate(const muc::array3d& x) const -> std::uint64_t;
+
+private:
+    std::uint64_t fUnbounded;
+    muc::array3d fMin;
+    muc::array3d fMax;
+    muc::array3d fInverseCellSize;
+    int fNCellPerAxis;
+    std::vector<std::uint64_t> fCell;
+};
+
+} // namespace Mustard::Detector::Field::internal
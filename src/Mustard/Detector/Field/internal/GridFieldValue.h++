@@ -0,0 +1,137 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/ceta_string"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief Read access to field map grid values stored in a given precision.
+/// Values are always read as double.
+/// @tparam APrecision "Double", "Float" (single precision) or "Quantized"
+/// (16-bit integers with a single precision scale per block of grid points
+/// and component, absolute error about 2^-16 of the block maximum).
+/// @tparam N Number of field components.
+template<muc::ceta_string APrecision, std::size_t N>
+    requires(APrecision == "Double" or APrecision == "Float" or APrecision == "Quantized")
+class GridFieldValue;
+
+template<std::size_t N>
+class GridFieldValue<"Double", N> {
+public:
+    GridFieldValue() = default;
+    GridFieldValue(const std::byte* data, std::size_t) :
+        fValue{reinterpret_cast<const double*>(data)} {}
+
+    MUSTARD_ALWAYS_INLINE auto operator[](std::size_t i) const -> double { return fValue[i]; }
+
+    /// @brief Bytes needed to store values of `nPoint` grid points.
+    static auto Size(std::size_t nPoint) -> std::size_t { return nPoint * N * sizeof(double); }
+    /// @brief Encode double values of grid points into `data`.
+    static auto Encode(std::span<const double> value, std::span<std::byte> data) -> void {
+        std::ranges::copy(value, reinterpret_cast<double*>(data.data()));
+    }
+
+private:
+    const double* fValue{};
+};
+
+template<std::size_t N>
+class GridFieldValue<"Float", N> {
+public:
+    GridFieldValue() = default;
+    GridFieldValue(const std::byte* data, std::size_t) :
+        fValue{reinterpret_cast<const float*>(data)} {}
+
+    MUSTARD_ALWAYS_INLINE auto operator[](std::size_t i) const -> double { return fValue[i]; }
+
+    /// @brief Bytes needed to store values of `nPoint` grid points.
+    static auto Size(std::size_t nPoint) -> std::size_t { return nPoint * N * sizeof(float); }
+    /// @brief Encode double values of grid points into `data`.
+    static auto Encode(std::span<const double> value, std::span<std::byte> data) -> void {
+        std::ranges::transform(value, reinterpret_cast<float*>(data.data()),
+                               [](double v) { return static_cast<float>(v); });
+    }
+
+private:
+    const float* fValue{};
+};
+
+template<std::size_t N>
+class GridFieldValue<"Quantized", N> {
+public:
+    GridFieldValue() = default;
+    GridFieldValue(const std::byte* data, std::size_t nPoint) :
+        fValue{reinterpret_cast<const std::int16_t*>(data)},
+        fScale{reinterpret_cast<const float*>(data + ScaleOffset(nPoint))} {}
+
+    MUSTARD_ALWAYS_INLINE auto operator[](std::size_t i) const -> double {
+        return fValue[i] * static_cast<double>(fScale[i / (fgBlockSize * N) * N + i % N]);
+    }
+
+    /// @brief Bytes needed to store values of `nPoint` grid points.
+    static auto Size(std::size_t nPoint) -> std::size_t {
+        return ScaleOffset(nPoint) + NBlock(nPoint) * N * sizeof(float);
+    }
+    /// @brief Encode double values of grid points into `data`.
+    static auto Encode(std::span<const double> value, std::span<std::byte> data) -> void {
+        const auto nPoint{value.size() / N};
+        const auto q{reinterpret_cast<std::int16_t*>(data.data())};
+        const auto scale{reinterpret_cast<float*>(data.data() + ScaleOffset(nPoint))};
+        for (std::size_t block{}; block < NBlock(nPoint); ++block) {
+            const auto begin{block * fgBlockSize};
+            const auto end{std::min(begin + fgBlockSize, nPoint)};
+            for (std::size_t k{}; k < N; ++k) {
+                double maxAbs{};
+                for (auto p{begin}; p < end; ++p) {
+                    maxAbs = std::max(maxAbs, std::abs(value[p * N + k]));
+                }
+                const auto s{static_cast<float>(maxAbs / fgQMax)};
+                scale[block * N + k] = s;
+                const auto inverseScale{s > 0 ? 1 / static_cast<double>(s) : 0};
+                for (auto p{begin}; p < end; ++p) {
+                    q[p * N + k] = std::clamp(std::lround(value[p * N + k] * inverseScale), -fgQMax, fgQMax);
+                }
+            }
+        }
+    }
+
+private:
+    static auto NBlock(std::size_t nPoint) -> std::size_t { return (nPoint + fgBlockSize - 1) / fgBlockSize; }
+    static auto ScaleOffset(std::size_t nPoint) -> std::size_t {
+        return (nPoint * N * sizeof(std::int16_t) + alignof(float) - 1) / alignof(float) * alignof(float);
+    }
+
+private:
+    const std::int16_t* fValue{};
+    const float* fScale{};
+
+    static constexpr std::size_t fgBlockSize{64};
+    static constexpr long fgQMax{32767};
+};
+
+} // namespace Mustard::Detector::Field::internal
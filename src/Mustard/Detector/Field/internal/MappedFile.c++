@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/internal/MappedFile.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "fmt/core.h"
+#include "fmt/std.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace Mustard::Detector::Field::internal {
+
+MappedFile::MappedFile(const std::filesystem::path& path) :
+    fData{},
+    fSize{} {
+#if defined _WIN32
+    const auto LastError{[] { return std::system_category().message(GetLastError()); }};
+    const auto file{CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE) {
+        Throw<std::runtime_error>(fmt::format("Cannot open '{}' ({})", path, LastError()));
+    }
+    // size of the opened file, which may differ from what is at path by now
+    LARGE_INTEGER size;
+    if (not GetFileSizeEx(file, &size)) {
+        const auto statError{LastError()};
+        CloseHandle(file);
+        Throw<std::runtime_error>(fmt::format("Cannot stat '{}' ({})", path, statError));
+    }
+    fSize = size.QuadPart;
+    // the view keeps the mapping and the file alive after their handles are closed
+    const auto mapping{CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+    const auto data{mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr};
+    const auto mmapError{data ? std::string{} : LastError()};
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (data == nullptr) {
+        Throw<std::runtime_error>(fmt::format("Cannot map '{}' into memory ({})", path, mmapError));
+    }
+#else
+    const auto fd{open(path.c_str(), O_RDONLY)};
+    if (fd < 0) {
+        Throw<std::runtime_error>(fmt::format("Cannot open '{}' ({})", path, std::strerror(errno)));
+    }
+    // size of the opened file, which may differ from what is at path by now
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        const auto statError{errno};
+        close(fd);
+        Throw<std::runtime_error>(fmt::format("Cannot stat '{}' ({})", path, std::strerror(statError)));
+    }
+    fSize = status.st_size;
+    const auto data{mmap(nullptr, fSize, PROT_READ, MAP_SHARED, fd, 0)};
+    const auto mmapError{errno};
+    close(fd);
+    if (data == MAP_FAILED) {
+        Throw<std::runtime_error>(fmt::format("Cannot map '{}' into memory ({})", path, std::strerror(mmapError)));
+    }
+#endif
+    fData = static_cast<const std::byte*>(data);
+}
+
+MappedFile::~MappedFile() {
+    if (fData) {
+#if defined _WIN32
+        UnmapViewOfFile(fData);
+#else
+        munmap(const_cast<std::byte*>(fData), fSize);
+#endif
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    fData{std::exchange(other.fData, nullptr)},
+    fSize{std::exchange(other.fSize, 0)} {}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    std::swap(fData, other.fData);
+    std::swap(fSize, other.fSize);
+    return *this;
+}
+
+} // namespace Mustard::Detector::Field::internal
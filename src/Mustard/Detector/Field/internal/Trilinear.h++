@@ -0,0 +1,46 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include <array>
+#include <cstddef>
+
+namespace Mustard::Detector::Field::internal {
+
+/// @brief Trilinear interpolation of N-component values on the 8 corners of a
+/// box, ordered as (x, y, z) = 000, 001, 010, 011, 100, 101, 110, 111.
+/// @param t Local coordinates in the box, each in [0, 1].
+template<std::size_t N>
+MUSTARD_ALWAYS_INLINE auto Trilinear(const std::array<double, 8 * N>& corner, const std::array<double, 3>& t) -> std::array<double, N> {
+    std::array<double, N> f;
+    for (std::size_t k{}; k < N; ++k) {
+        const auto f00{corner[k] + t[2] * (corner[N + k] - corner[k])};
+        const auto f01{corner[2 * N + k] + t[2] * (corner[3 * N + k] - corner[2 * N + k])};
+        const auto f10{corner[4 * N + k] + t[2] * (corner[5 * N + k] - corner[4 * N + k])};
+        const auto f11{corner[6 * N + k] + t[2] * (corner[7 * N + k] - corner[6 * N + k])};
+        const auto f0{f00 + t[1] * (f01 - f00)};
+        const auto f1{f10 + t[1] * (f11 - f10)};
+        f[k] = f0 + t[0] * (f1 - f0);
+    }
+    return f;
+}
+
+} // namespace Mustard::Detector::Field::internal
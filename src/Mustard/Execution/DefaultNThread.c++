@@ -0,0 +1,59 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Execution/DefaultNThread.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "envparse/parse.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace Mustard::inline Execution {
+
+auto DefaultNThread() -> int {
+    const auto envNThread{envparse::parse<envparse::not_set_option::left_blank>("${MUSTARD_EXECUTION_NTHREAD}")};
+    if (envNThread.empty()) {
+        return 1;
+    }
+    if (envNThread == "auto") {
+        const auto nHardwareThread{std::max(1u, std::thread::hardware_concurrency())};
+        if (not mplr::available() or not Env::MPIEnv::Available()) {
+            return nHardwareThread;
+        }
+        const auto nIntraNodeProcess{Env::MPIEnv::Instance().IntraNodeComm().size()};
+        return std::max(1, static_cast<int>(nHardwareThread) / nIntraNodeProcess);
+    }
+    int nThread{};
+    const auto [ptr, ec]{std::from_chars(envNThread.data(), envNThread.data() + envNThread.size(), nThread)};
+    if (ec != std::errc{} or ptr != envNThread.data() + envNThread.size() or nThread < 1) {
+        Throw<std::invalid_argument>(fmt::format("Invalid MUSTARD_EXECUTION_NTHREAD '{}' (should be a positive integer or 'auto')", envNThread));
+    }
+    return nThread;
+}
+
+} // namespace Mustard::inline Execution
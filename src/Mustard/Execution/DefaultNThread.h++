@@ -0,0 +1,31 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace Mustard::inline Execution {
+
+/// @brief Suggested number of worker threads per process for `Executor`.
+/// Read from environment variable MUSTARD_EXECUTION_NTHREAD, which can be a
+/// positive integer or "auto" (hardware threads shared by ranks on the node).
+/// Returns 1 (no thread pool) if the variable is not set. Executors are
+/// single-threaded unless this is passed explicitly, as most tasks (Geant4
+/// events, data batches) are not safe to run concurrently.
+auto DefaultNThread() -> int;
+
+} // namespace Mustard::inline Execution
@@ -18,9 +18,11 @@
 
 #pragma once
 
+#include "Mustard/Execution/DefaultNThread.h++"
 #include "Mustard/Execution/DefaultScheduler.h++"
 #include "Mustard/Execution/Scheduler.h++"
 #include "Mustard/Execution/internal/ExecutorImplBase.h++"
+#include "Mustard/Execution/internal/HybridExecutorImpl.h++"
 #include "Mustard/Execution/internal/ParallelExecutorImpl.h++"
 #include "Mustard/Execution/internal/SequentialExecutorImpl.h++"
 
@@ -41,15 +43,16 @@ public:
     using ExecutionInfoType = typename internal::ExecutorImplBase<T>::ExecutionInfoType;
 
 public:
-    Executor(std::string_view scheduler = DefaultSchedulerCode());
-    Executor(std::string executionName, std::string taskName, std::string_view scheduler = DefaultSchedulerCode());
-    Executor(std::unique_ptr<Scheduler<T>> scheduler);
-    Executor(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler);
+    Executor(std::string_view scheduler = DefaultSchedulerCode(), int nThread = 1);
+    Executor(std::string executionName, std::string taskName, std::string_view scheduler = DefaultSchedulerCode(), int nThread = 1);
+    Executor(std::unique_ptr<Scheduler<T>> scheduler, int nThread = 1);
+    Executor(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler, int nThread = 1);
 
     auto SwitchScheduler(std::string_view scheduler) -> void;
     auto SwitchScheduler(std::unique_ptr<Scheduler<T>> scheduler) -> void;
 
     auto NProcess() const -> int;
+    auto NThread() const -> int;
 
     auto Task() const -> struct Scheduler<T>::Task;
     auto NTask() const -> T;
@@ -76,7 +79,8 @@ public:
 
 private:
     using Impl = std::variant<internal::ParallelExecutorImpl<T>,
-                              internal::SequentialExecutorImpl<T>>;
+                              internal::SequentialExecutorImpl<T>,
+                              internal::HybridExecutorImpl<T>>;
 
 private:
     std::unique_ptr<Impl> fImpl;
@@ -19,20 +19,25 @@
 namespace Mustard::inline Execution {
 
 template<std::integral T>
-Executor<T>::Executor(std::string_view scheduler) :
-    Executor{MakeCodedScheduler<T>(scheduler)} {}
+Executor<T>::Executor(std::string_view scheduler, int nThread) :
+    Executor{MakeCodedScheduler<T>(scheduler), nThread} {}
 
 template<std::integral T>
-Executor<T>::Executor(std::string executionName, std::string taskName, std::string_view scheduler) :
-    Executor{std::move(executionName), std::move(taskName), MakeCodedScheduler<T>(scheduler)} {}
+Executor<T>::Executor(std::string executionName, std::string taskName, std::string_view scheduler, int nThread) :
+    Executor{std::move(executionName), std::move(taskName), MakeCodedScheduler<T>(scheduler), nThread} {}
 
 template<std::integral T>
-Executor<T>::Executor(std::unique_ptr<Scheduler<T>> scheduler) :
-    Executor{"Execution", "Task", std::move(scheduler)} {}
+Executor<T>::Executor(std::unique_ptr<Scheduler<T>> scheduler, int nThread) :
+    Executor{"Execution", "Task", std::move(scheduler), nThread} {}
 
 template<std::integral T>
-Executor<T>::Executor(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler) :
+Executor<T>::Executor(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler, int nThread) :
     fImpl{[&] {
+        if (nThread > 1) {
+            return std::make_unique<Impl>(
+                std::in_place_type<internal::HybridExecutorImpl<T>>,
+                std::move(executionName), std::move(taskName), std::move(scheduler), nThread);
+        }
         if (not mplr::available() or mplr::comm_world().size() == 1) {
             return std::make_unique<Impl>(
                 std::in_place_type<internal::SequentialExecutorImpl<T>>,
@@ -67,6 +72,18 @@ auto Executor<T>::NProcess() const -> int {
                       *fImpl);
 }
 
+template<std::integral T>
+auto Executor<T>::NThread() const -> int {
+    return std::visit([&](auto&& impl) -> int {
+        if constexpr (requires { impl.NThread(); }) {
+            return impl.NThread();
+        } else {
+            return 1;
+        }
+    },
+                      *fImpl);
+}
+
 template<std::integral T>
 auto Executor<T>::Task() const -> struct Scheduler<T>::Task {
     return std::visit([&](auto&& impl) {
@@ -28,19 +28,24 @@
 #include "mplr/mplr.hpp"
 
 #include "muc/chrono"
+#include "muc/numeric"
 
 #include "gsl/gsl"
 
 #include "fmt/chrono.h"
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace Mustard::inline Execution::internal {
 
@@ -85,6 +90,11 @@ public:
 protected:
     auto PreLoopReport() const -> void;
     auto PostLoopReport() const -> void;
+    /// @brief Gather execution info of all processes to rank 0 and reduce it into fExecutionInfo.
+    /// Calls PostLoopAction of the scheduler while the gather is in flight.
+    auto FinalizeExecutionInfo() -> void;
+    /// @brief Print per-process execution info on rank 0, with an optional note row at the bottom.
+    auto PrintProcessExecutionSummary(std::string_view note = {}) const -> void;
 
 protected:
     static auto ToDayHrMinSecMs(StopwatchDuration s) -> std::string;
@@ -105,6 +115,7 @@ protected:
     muc::chrono::processor_stopwatch fProcessorStopwatch;
 
     ExecutionInfoType fExecutionInfo;
+    std::vector<ExecutionInfoType> fExecutionInfoList;
 };
 
 } // namespace Mustard::inline Execution::internal
@@ -30,7 +30,8 @@ ExecutorImplBase<T>::ExecutorImplBase(std::string executionName, std::string tas
     fExecutionBeginTime{},
     fStopwatch{},
     fProcessorStopwatch{},
-    fExecutionInfo{} {}
+    fExecutionInfo{},
+    fExecutionInfoList{} {}
 
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
@@ -93,6 +94,77 @@ auto ExecutorImplBase<T>::PostLoopReport() const -> void {
           fmt::format("  Processor time: {:.3f} seconds ({})", Seconds{totalProcessorTime}.count(), ToDayHrMinSecMs(totalProcessorTime)));
 }
 
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::FinalizeExecutionInfo() -> void {
+    using ExecutionInfoTuple = std::tuple<T, typename StopwatchDuration::rep, typename StopwatchDuration::rep>;
+    std::tuple executionInfo{NLocalExecutedTask(), fStopwatch.read().count(), fProcessorStopwatch.read().count()};
+    constexpr auto ToExecutionInfo{[](const ExecutionInfoTuple& t) -> ExecutionInfoType {
+        return {.nExecutedTask = get<0>(t),
+                .wallTime = StopwatchDuration{get<1>(t)},
+                .processorTime = StopwatchDuration{get<2>(t)}};
+    }};
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    if (worldComm.is_valid()) {
+        std::vector<ExecutionInfoTuple> executionInfoList(worldComm.rank() == 0 ? worldComm.size() : 0);
+        auto gatherExecutionInfo{worldComm.igather(0, executionInfo, executionInfoList.data())};
+        fScheduler->PostLoopAction();
+        gatherExecutionInfo.wait(mplr::duty_ratio::preset::relaxed);
+        if (worldComm.rank() == 0) {
+            fExecutionInfoList.resize(worldComm.size());
+            std::ranges::transform(executionInfoList, fExecutionInfoList.begin(), ToExecutionInfo);
+            auto& [totalExecutedTask, maxTime, totalProcessorTime]{executionInfo};
+            totalExecutedTask = muc::ranges::transform_reduce(
+                fExecutionInfoList, T{}, std::plus{}, [](auto&& a) { return a.nExecutedTask; });
+            maxTime = std::ranges::max_element(
+                          fExecutionInfoList, std::less{}, [](auto&& a) { return a.wallTime; })
+                          ->wallTime.count();
+            totalProcessorTime = muc::ranges::transform_reduce(
+                                     fExecutionInfoList, StopwatchDuration::zero(), std::plus{}, [](auto&& a) { return a.processorTime; })
+                                     .count();
+        }
+        worldComm.ibcast(0, executionInfo).wait(mplr::duty_ratio::preset::relaxed);
+    } else {
+        fScheduler->PostLoopAction();
+        fExecutionInfoList.assign(1, ToExecutionInfo(executionInfo));
+    }
+    fExecutionInfo = ToExecutionInfo(executionInfo);
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::PrintProcessExecutionSummary(std::string_view note) const -> void {
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    if (worldComm.is_valid() and worldComm.rank() != 0) {
+        return;
+    }
+    if (fExecutionInfoList.empty() or fExecuting) {
+        PrintWarning("Execution summary not available for now");
+        return;
+    }
+    Print("+------------------+--------------> Summary <-------------+-------------------+\n"
+          "| Rank in world    | Executed          | Wall time (s)    | Processor t. (s)  |\n"
+          "+------------------+-------------------+------------------+-------------------+\n");
+    using Seconds = muc::chrono::seconds<double>;
+    for (gsl::index rank{}; rank < ssize(fExecutionInfoList); ++rank) {
+        const auto& [executed, time, processorTime]{fExecutionInfoList[rank]};
+        PrintLn("| {:16} | {:17} | {:16.3f} | {:17.3f} |",
+                rank, executed, Seconds{time}.count(), Seconds{processorTime}.count());
+    }
+    const auto& [nTotalExecutedTask, maxTime, totalProcessorTime]{fExecutionInfo};
+    if (fExecutionInfoList.size() > 1) {
+        PrintLn("+------------------+-------------------+------------------+-------------------+\n"
+                "| Total or max     | {:17} | {:16.3f} | {:17.3f} |",
+                nTotalExecutedTask, Seconds{maxTime}.count(), Seconds{totalProcessorTime}.count());
+    }
+    PrintLn("+------------------+--------------> Summary <-------------+-------------------+");
+    if (not note.empty()) {
+        PrintLn("| {:75} |\n"
+                "+-----------------------------------------------------------------------------+",
+                note);
+    }
+}
+
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto ExecutorImplBase<T>::ToDayHrMinSecMs(StopwatchDuration duration) -> std::string {
@@ -0,0 +1,99 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/Execution/internal/ExecutorImplBase.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Utility/FormatToLocalTime.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/chrono"
+#include "muc/math"
+#include "muc/numeric"
+
+#include "gsl/gsl"
+
+#include "fmt/chrono.h"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Mustard::inline Execution::internal {
+
+/// @brief Executor implementation running a pool of worker threads in each process.
+/// Tasks are claimed from the scheduler by the calling thread (so that inter-process
+/// load balancing is unchanged), and distributed to per-thread deques. Idle worker
+/// threads steal tasks from the others. The number of claimed but unfinished tasks
+/// is bounded, so that a process does not claim far ahead of what it can execute.
+/// The task function is invoked concurrently and must be thread-safe.
+template<std::integral T>
+class HybridExecutorImpl final : public ExecutorImplBase<T> {
+public:
+    HybridExecutorImpl(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler, int nThread);
+
+    auto NProcess() const -> int { return mplr::available() ? mplr::comm_world().size() : 1; }
+    auto NThread() const -> auto { return fNThread; }
+
+    auto operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
+    auto PrintExecutionSummary() const -> void;
+
+private:
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;
+        std::deque<T> deque;
+    };
+
+private:
+    auto Push(int iThread, T taskID) -> void;
+    auto Pop(int iThread) -> std::optional<T>;
+    auto PostTaskReport(T iEnded) const -> void;
+
+private:
+    using typename ExecutorImplBase<T>::StopwatchDuration;
+
+private:
+    int fNThread;
+    std::unique_ptr<WorkQueue[]> fWorkQueue;
+
+    static constexpr auto fgNQueuedTaskPerThread{4};
+};
+
+} // namespace Mustard::inline Execution::internal
+
+#include "Mustard/Execution/internal/HybridExecutorImpl.inl"
@@ -0,0 +1,209 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution::internal {
+
+template<std::integral T>
+HybridExecutorImpl<T>::HybridExecutorImpl(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler, int nThread) :
+    ExecutorImplBase<T>{std::move(executionName), std::move(taskName), std::move(scheduler)},
+    fNThread{nThread},
+    fWorkQueue{} {
+    if (fNThread < 1) {
+        Throw<std::invalid_argument>(fmt::format("Number of threads ({}) < 1", fNThread));
+    }
+    fWorkQueue = std::make_unique<WorkQueue[]>(fNThread);
+    using std::chrono_literals::operator""s;
+    this->fPrintProgressInterval = 3s;
+}
+
+template<std::integral T>
+auto HybridExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T {
+    // reset
+    if (task.last < task.first) {
+        Throw<std::invalid_argument>(fmt::format("task.last ({}) < task.first ({})", task.last, task.first));
+    }
+    if (task.last == task.first) {
+        return 0;
+    }
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    const auto nTask{task.last - task.first};
+    if (worldComm.is_valid() and nTask < static_cast<T>(worldComm.size())) {
+        Throw<std::runtime_error>(fmt::format("Number of tasks ({}) < number of processes ({})", nTask, worldComm.size()));
+    }
+    this->fScheduler->Task(task);
+    this->fScheduler->Reset();
+    Expects(this->ExecutingTask() == this->Task().first);
+    Expects(this->NLocalExecutedTask() == 0);
+    Expects(this->fScheduler->NExecutedTaskEstimation().second == 0);
+    // initialize
+    this->fExecuting = true;
+    this->fScheduler->PreLoopAction();
+    if (worldComm.is_valid()) {
+        worldComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+    }
+    this->fExecutionBeginTime = std::chrono::system_clock::now();
+    this->fStopwatch.reset();
+    this->fProcessorStopwatch.reset();
+    this->PreLoopReport();
+    // worker threads
+    std::counting_semaphore<> queued{0};
+    std::counting_semaphore<> vacancy{fgNQueuedTaskPerThread * fNThread};
+    std::atomic<T> nPending{};
+    std::atomic<T> nCompleted{};
+    std::atomic<T> lastCompleted{};
+    std::atomic_bool allQueued{};
+    std::atomic_bool aborted{};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    std::vector<std::jthread> worker;
+    worker.reserve(fNThread);
+    for (int iThread{}; iThread < fNThread; ++iThread) {
+        worker.emplace_back([&, iThread] {
+            while (true) {
+                // each permit is either a queued task or, after all tasks queued, a stop token
+                queued.acquire();
+                auto taskID{Pop(iThread)};
+                while (not taskID.has_value()) {
+                    if (allQueued.load(std::memory_order::acquire) and nPending.load(std::memory_order::acquire) == 0) {
+                        return;
+                    }
+                    std::this_thread::yield();
+                    taskID = Pop(iThread);
+                }
+                nPending.fetch_sub(1, std::memory_order::acq_rel);
+                if (not aborted.load(std::memory_order::relaxed)) {
+                    try {
+                        std::invoke(F, *taskID);
+                        lastCompleted.store(*taskID, std::memory_order::relaxed);
+                        nCompleted.fetch_add(1, std::memory_order::release);
+                    } catch (...) {
+                        const std::scoped_lock lock{exceptionMutex};
+                        if (not exception) {
+                            exception = std::current_exception();
+                        }
+                        aborted.store(true, std::memory_order::relaxed);
+                    }
+                }
+                vacancy.release();
+            }
+        });
+    }
+    // completions are counted by worker threads, and brought to the scheduler by the calling thread
+    const auto SyncCompletedTask{[&] {
+        for (const auto n{nCompleted.load(std::memory_order::acquire)}; this->NLocalExecutedTask() < n;) {
+            this->fScheduler->IncrementNLocalExecutedTask();
+            PostTaskReport(lastCompleted.load(std::memory_order::relaxed));
+        }
+    }};
+    // main loop: claim tasks from scheduler and feed worker threads
+    for (int iThread{}; this->ExecutingTask() != this->Task().last; iThread = (iThread + 1) % fNThread) {
+        vacancy.acquire();
+        this->fScheduler->PreTaskAction();
+        const auto taskID{this->ExecutingTask()};
+        Ensures(taskID <= this->Task().last);
+        nPending.fetch_add(1, std::memory_order::acq_rel);
+        Push(iThread, taskID);
+        queued.release();
+        this->fScheduler->PostTaskAction();
+        SyncCompletedTask();
+    }
+    allQueued.store(true, std::memory_order::release);
+    queued.release(fNThread);
+    for (auto&& thread : worker) {
+        thread.join();
+    }
+    SyncCompletedTask();
+    // finalize
+    this->FinalizeExecutionInfo();
+    this->fExecuting = false;
+    this->PostLoopReport();
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return this->NLocalExecutedTask();
+}
+
+template<std::integral T>
+auto HybridExecutorImpl<T>::PrintExecutionSummary() const -> void {
+    this->PrintProcessExecutionSummary(fmt::format("{} worker thread{} per process", fNThread, fNThread > 1 ? "s" : ""));
+}
+
+template<std::integral T>
+auto HybridExecutorImpl<T>::Push(int iThread, T taskID) -> void {
+    auto& [mutex, deque]{fWorkQueue[iThread]};
+    const std::scoped_lock lock{mutex};
+    deque.push_back(taskID);
+}
+
+template<std::integral T>
+auto HybridExecutorImpl<T>::Pop(int iThread) -> std::optional<T> {
+    // own queue first (LIFO, cache-friendly)
+    {
+        auto& [mutex, deque]{fWorkQueue[iThread]};
+        const std::scoped_lock lock{mutex};
+        if (not deque.empty()) {
+            const auto taskID{deque.back()};
+            deque.pop_back();
+            return taskID;
+        }
+    }
+    // then steal from others (FIFO, oldest first)
+    for (int i{1}; i < fNThread; ++i) {
+        auto& [mutex, deque]{fWorkQueue[(iThread + i) % fNThread]};
+        const std::scoped_lock lock{mutex};
+        if (not deque.empty()) {
+            const auto taskID{deque.front()};
+            deque.pop_front();
+            return taskID;
+        }
+    }
+    return std::nullopt;
+}
+
+template<std::integral T>
+auto HybridExecutorImpl<T>::PostTaskReport(T iEnded) const -> void {
+    if (not this->fPrintProgress) {
+        return;
+    }
+    const auto [goodEstimation, nExecutedTask]{this->fScheduler->NExecutedTaskEstimation()};
+    const auto elapsed{this->fStopwatch.read()};
+    const auto speed{static_cast<double>(nExecutedTask) / elapsed.count()};
+    const std::chrono::duration<double, typename StopwatchDuration::period> printInterval{this->fPrintProgressInterval};
+    if (this->NLocalExecutedTask() % std::max(1ll, muc::llround(speed * printInterval.count())) != 0) {
+        return;
+    }
+    const auto rank{mplr::available() ? mplr::comm_world().rank() : 0};
+    const auto perSecondSpeed{muc::chrono::seconds<double>{1} / StopwatchDuration{1} * speed};
+    const auto now{std::chrono::system_clock::now()};
+    Print("MPI{}> [{}] {} {} has ended\n"
+          "MPI{}>   {} elaps., {}\n",
+          rank, FormatToLocalTime(now), this->fTaskName, iEnded,
+          rank, this->ToDayHrMinSecMs(elapsed),
+          [&, good{goodEstimation}, nExecuted{nExecutedTask}] {
+              if (good) {
+                  const StopwatchDuration eta{muc::llround((this->NTask() - nExecuted) / speed)};
+                  const auto progress{100. * nExecuted / this->NTask()};
+                  return fmt::format("est. rem. {} ({:.3}/s), prog.: {} | {}/{} | {:.3}%",
+                                     this->ToDayHrMinSecMs(eta), perSecondSpeed, this->NLocalExecutedTask(), nExecuted, this->NTask(), progress);
+              } else {
+                  return fmt::format("local prog.: {}", this->NLocalExecutedTask());
+              }
+          }());
+}
+
+} // namespace Mustard::inline Execution::internal
@@ -64,10 +64,6 @@ private:
 
 private:
     using typename ExecutorImplBase<T>::StopwatchDuration;
-    using typename ExecutorImplBase<T>::ExecutionInfoType;
-
-private:
-    std::vector<ExecutionInfoType> fExecutionInfoList;
 };
 
 } // namespace Mustard::inline Execution::internal
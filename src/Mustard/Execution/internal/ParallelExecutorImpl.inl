@@ -20,8 +20,7 @@ namespace Mustard::inline Execution::internal {
 
 template<std::integral T>
 ParallelExecutorImpl<T>::ParallelExecutorImpl(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler) :
-    ExecutorImplBase<T>{std::move(executionName), std::move(taskName), std::move(scheduler)},
-    fExecutionInfoList{} {
+    ExecutorImplBase<T>{std::move(executionName), std::move(taskName), std::move(scheduler)} {
     using std::chrono_literals::operator""s;
     this->fPrintProgressInterval = 3s;
 }
@@ -64,32 +63,7 @@ auto ParallelExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::in
         PostTaskReport(taskID);
     }
     // finalize
-    using ExecutionInfoTuple = std::tuple<T, typename StopwatchDuration::rep, typename StopwatchDuration::rep>;
-    std::tuple executionInfo{this->NLocalExecutedTask(), this->fStopwatch.read().count(), this->fProcessorStopwatch.read().count()};
-    std::vector<ExecutionInfoTuple> executionInfoList(worldComm.rank() == 0 ? worldComm.size() : 0);
-    auto gatherExecutionInfo{worldComm.igather(0, executionInfo, executionInfoList.data())};
-    this->fScheduler->PostLoopAction();
-    gatherExecutionInfo.wait(mplr::duty_ratio::preset::relaxed);
-    constexpr auto ToExecutionInfo{[](const ExecutionInfoTuple& t) -> ExecutionInfoType {
-        return {.nExecutedTask = get<0>(t),
-                .wallTime = StopwatchDuration{get<1>(t)},
-                .processorTime = StopwatchDuration{get<2>(t)}};
-    }};
-    if (worldComm.rank() == 0) {
-        fExecutionInfoList.resize(worldComm.size());
-        std::ranges::transform(executionInfoList, fExecutionInfoList.begin(), ToExecutionInfo);
-        auto& [totalExecutedTask, maxTime, totalProcessorTime]{executionInfo};
-        totalExecutedTask = muc::ranges::transform_reduce(
-            fExecutionInfoList, T{}, std::plus{}, [](auto&& a) { return a.nExecutedTask; });
-        maxTime = std::ranges::max_element(
-                      fExecutionInfoList, std::less{}, [](auto&& a) { return a.wallTime; })
-                      ->wallTime.count();
-        totalProcessorTime = muc::ranges::transform_reduce(
-                                 fExecutionInfoList, StopwatchDuration::zero(), std::plus{}, [](auto&& a) { return a.processorTime; })
-                                 .count();
-    }
-    worldComm.ibcast(0, executionInfo).wait(mplr::duty_ratio::preset::relaxed);
-    this->fExecutionInfo = ToExecutionInfo(executionInfo);
+    this->FinalizeExecutionInfo();
     this->fExecuting = false;
     this->PostLoopReport();
     return this->NLocalExecutedTask();
@@ -97,31 +71,7 @@ auto ParallelExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::in
 
 template<std::integral T>
 auto ParallelExecutorImpl<T>::PrintExecutionSummary() const -> void {
-    const auto worldComm{mplr::comm_world()};
-    if (worldComm.rank() != 0) {
-        return;
-    }
-    if (fExecutionInfoList.empty() or this->fExecuting) {
-        PrintWarning("Execution summary not available for now");
-        return;
-    }
-    Print("+------------------+--------------> Summary <-------------+-------------------+\n"
-          "| Rank in world    | Executed          | Wall time (s)    | Processor t. (s)  |\n"
-          "+------------------+-------------------+------------------+-------------------+\n");
-    Expects(ssize(fExecutionInfoList) == worldComm.size());
-    using Seconds = muc::chrono::seconds<double>;
-    for (int rank{}; rank < worldComm.size(); ++rank) {
-        const auto& [executed, time, processorTime]{fExecutionInfoList[rank]};
-        PrintLn("| {:16} | {:17} | {:16.3f} | {:17.3f} |",
-                rank, executed, Seconds{time}.count(), Seconds{processorTime}.count());
-    }
-    const auto& [nTotalExecutedTask, maxTime, totalProcessorTime]{this->fExecutionInfo};
-    if (worldComm.size() > 1) {
-        PrintLn("+------------------+-------------------+------------------+-------------------+\n"
-                "| Total or max     | {:17} | {:16.3f} | {:17.3f} |",
-                nTotalExecutedTask, Seconds{maxTime}.count(), Seconds{totalProcessorTime}.count());
-    }
-    PrintLn("+------------------+--------------> Summary <-------------+-------------------+");
+    this->PrintProcessExecutionSummary();
 }
 
 template<std::integral T>
@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Math/internal/SobolDirectionNumber.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "gsl/gsl"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Mustard::inline Math {
+
+/// @brief Randomized Sobol sequence on the unit hypercube [0,1]^D
+///
+/// The sequence is randomized by a random linear matrix scrambling followed by
+/// a random digital shift. A randomized sequence is unbiased, and independent
+/// randomizations give independent estimates, from which the error of a
+/// quasi-Monte Carlo integral can be estimated. For smooth integrands the
+/// error decreases roughly as O(1/N) instead of O(1/√N).
+/// Based on:
+///   J. Matoušek, On the L2-discrepancy for anchored boxes, J. Complexity 14 (1998) 527
+///   A. B. Owen, Randomly permuted (t,m,s)-nets and (t,s)-sequences (1995)
+///
+/// Points are random accessible, so that samples can be distributed across
+/// processes by index (i.e. skip-ahead costs nothing).
+///
+/// @tparam D Dimension (1 ≤ D ≤ 21)
+template<int D>
+    requires(1 <= D and D <= 21)
+class ScrambledSobol {
+public:
+    /// @brief Construct a new randomization of the Sobol sequence
+    /// @param rng Reference to CLHEP random engine
+    explicit ScrambledSobol(CLHEP::HepRandomEngine& rng);
+
+    /// @brief Get the i-th point of the sequence
+    /// @param i Point index (0 ≤ i < 2^32)
+    /// @return Point in (0,1)^D
+    auto operator()(std::uint64_t i) const -> std::array<double, D>;
+
+private:
+    std::array<std::array<std::uint32_t, 32>, D> fDirection; ///< Scrambled direction numbers
+    std::array<std::uint32_t, D> fShift;                     ///< Digital shift
+};
+
+} // namespace Mustard::inline Math
+
+#include "Mustard/Math/ScrambledSobol.inl"
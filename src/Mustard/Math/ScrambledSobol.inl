@@ -0,0 +1,81 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Math {
+
+template<int D>
+    requires(1 <= D and D <= 21)
+ScrambledSobol<D>::ScrambledSobol(CLHEP::HepRandomEngine& rng) :
+    fDirection{},
+    fShift{} {
+    const auto RandomBits{[&rng] { return static_cast<std::uint32_t>(rng.flat() * 0x1p32); }};
+    for (int d{}; d < D; ++d) {
+        // direction numbers, v[k] for bit k of index
+        std::array<std::uint32_t, 32> v;
+        if (d == 0) {
+            for (int k{}; k < 32; ++k) {
+                v[k] = std::uint32_t{1} << (31 - k);
+            }
+        } else {
+            const auto& [s, a, m]{internal::gSobolDirectionNumber[d - 1]};
+            for (int k{}; k < s; ++k) {
+                v[k] = m[k] << (31 - k);
+            }
+            for (int k{s}; k < 32; ++k) {
+                v[k] = v[k - s] ^ (v[k - s] >> s);
+                for (int l{1}; l < s; ++l) {
+                    v[k] ^= ((a >> (s - 1 - l)) & 1) * v[k - l];
+                }
+            }
+        }
+        // linear matrix scrambling: each digit is XORed with a random
+        // combination of more significant digits
+        std::array<std::uint32_t, 32> row;
+        for (int r{}; r < 32; ++r) {
+            const auto diagonal{std::uint32_t{1} << (31 - r)};
+            const auto upper{r == 0 ? std::uint32_t{} : ~std::uint32_t{} << (32 - r)};
+            row[r] = diagonal | (RandomBits() & upper);
+        }
+        for (int k{}; k < 32; ++k) {
+            std::uint32_t scrambled{};
+            for (int r{}; r < 32; ++r) {
+                scrambled |= static_cast<std::uint32_t>(std::popcount(row[r] & v[k]) & 1) << (31 - r);
+            }
+            fDirection[d][k] = scrambled;
+        }
+        fShift[d] = RandomBits();
+    }
+}
+
+template<int D>
+    requires(1 <= D and D <= 21)
+auto ScrambledSobol<D>::operator()(std::uint64_t i) const -> std::array<double, D> {
+    Expects(i < (std::uint64_t{1} << 32));
+    const auto gray{static_cast<std::uint32_t>(i ^ (i >> 1))};
+    std::array<double, D> x;
+    for (int d{}; d < D; ++d) {
+        auto bits{fShift[d]};
+        for (auto g{gray}; g != 0; g &= g - 1) {
+            bits ^= fDirection[d][std::countr_zero(g)];
+        }
+        x[d] = (bits + 0.5) * 0x1p-32;
+    }
+    return x;
+}
+
+} // namespace Mustard::inline Math
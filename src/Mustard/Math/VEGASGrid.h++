@@ -0,0 +1,89 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <span>
+
+namespace Mustard::inline Math {
+
+/// @brief Adaptive grid of the VEGAS algorithm on the unit hypercube [0,1]^D
+///
+/// Maps uniform variates y in [0,1]^D to x in [0,1]^D, such that each of
+/// the NBin bins per dimension is hit with equal probability. Bin widths
+/// are refined iteratively to be narrow where |f| is large, which reduces the
+/// variance of f(x) × J(y), J being the Jacobian of the map.
+/// Based on:
+///   G. P. Lepage, A new algorithm for adaptive multidimensional integration,
+///   J. Comput. Phys. 27 (1978) 192
+///
+/// Usage: for each sample, `Map` the variates, evaluate f × J and `Accumulate`
+/// (f × J)². After an iteration, `Refine` the grid. The accumulator is
+/// exposed so that it can be summed over processes before refining.
+///
+/// @tparam D Dimension
+/// @tparam NBin Number of bins per dimension
+template<int D, int NBin = 50>
+    requires(D >= 1 and NBin >= 2)
+class VEGASGrid {
+public:
+    /// @brief Result of mapping uniform variates
+    struct Point {
+        std::array<double, D> x; ///< Mapped point
+        double jacobian;         ///< Jacobian of the map at x
+        std::array<int, D> bin;  ///< Bin index of x in each dimension
+    };
+
+public:
+    /// @brief Construct a uniform grid
+    /// @param alpha Damping parameter of refinement (typically 0.5--2, 0 for no adaption)
+    constexpr explicit VEGASGrid(double alpha = 1.5);
+
+    /// @brief Map uniform variates to the grid
+    /// @param y Flat random numbers in 0--1
+    constexpr auto Map(const std::array<double, D>& y) const -> Point;
+    /// @brief Accumulate the squared weighted integrand of a sample
+    /// @param bin Bins of the sample (from `Map`)
+    /// @param f2 (f × J)² of the sample
+    constexpr auto Accumulate(const std::array<int, D>& bin, double f2) -> void;
+    /// @brief Accumulated (f × J)² in each bin, flattened as [dimension][bin]
+    constexpr auto Accumulator() -> std::span<double> { return fAccumulator; }
+    /// @brief Refine the grid according to the accumulator, then clear the accumulator
+    auto Refine() -> void;
+
+    /// @brief Bin edges, flattened as [dimension][edge] with NBin + 1 edges per dimension
+    constexpr auto Edge() const -> const auto& { return fEdge; }
+    constexpr auto Alpha() const -> auto { return fAlpha; }
+    constexpr auto Alpha(double alpha) -> void { fAlpha = alpha; }
+
+private:
+    double fAlpha;                             ///< Damping parameter
+    std::array<double, D * (NBin + 1)> fEdge;  ///< Bin edges
+    std::array<double, D * NBin> fAccumulator; ///< Accumulated (f × J)²
+};
+
+} // namespace Mustard::inline Math
+
+#include "Mustard/Math/VEGASGrid.inl"
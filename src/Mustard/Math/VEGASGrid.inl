@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Math {
+
+template<int D, int NBin>
+    requires(D >= 1 and NBin >= 2)
+constexpr VEGASGrid<D, NBin>::VEGASGrid(double alpha) :
+    fAlpha{alpha},
+    fEdge{},
+    fAccumulator{} {
+    Expects(alpha >= 0);
+    for (int d{}; d < D; ++d) {
+        for (int i{}; i <= NBin; ++i) {
+            fEdge[d * (NBin + 1) + i] = static_cast<double>(i) / NBin;
+        }
+    }
+}
+
+template<int D, int NBin>
+    requires(D >= 1 and NBin >= 2)
+constexpr auto VEGASGrid<D, NBin>::Map(const std::array<double, D>& y) const -> Point {
+    Point point;
+    point.jacobian = 1;
+    for (int d{}; d < D; ++d) {
+        const auto s{y[d] * NBin};
+        const auto i{std::clamp(static_cast<int>(s), 0, NBin - 1)};
+        const auto edge{&fEdge[d * (NBin + 1) + i]};
+        const auto width{edge[1] - edge[0]};
+        point.x[d] = edge[0] + (s - i) * width;
+        point.jacobian *= NBin * width;
+        point.bin[d] = i;
+    }
+    return point;
+}
+
+template<int D, int NBin>
+    requires(D >= 1 and NBin >= 2)
+constexpr auto VEGASGrid<D, NBin>::Accumulate(const std::array<int, D>& bin, double f2) -> void {
+    for (int d{}; d < D; ++d) {
+        fAccumulator[d * NBin + bin[d]] += f2;
+    }
+}
+
+template<int D, int NBin>
+    requires(D >= 1 and NBin >= 2)
+auto VEGASGrid<D, NBin>::Refine() -> void {
+    for (int d{}; d < D; ++d) {
+        const auto accumulator{&fAccumulator[d * NBin]};
+        const auto edge{&fEdge[d * (NBin + 1)]};
+        // smooth over neighbouring bins
+        std::array<double, NBin> weight;
+        weight.front() = (accumulator[0] + accumulator[1]) / 2;
+        for (int i{1}; i < NBin - 1; ++i) {
+            weight[i] = (accumulator[i - 1] + accumulator[i] + accumulator[i + 1]) / 3;
+        }
+        weight.back() = (accumulator[NBin - 2] + accumulator[NBin - 1]) / 2;
+        const auto sum{std::accumulate(weight.cbegin(), weight.cend(), 0.)};
+        if (not(sum > 0) or not std::isfinite(sum)) {
+            continue;
+        }
+        // damp the adaption
+        for (auto&& w : weight) {
+            const auto r{w / sum};
+            w = r > 0 and r < 1 ? std::pow((r - 1) / std::log(r), fAlpha) : r;
+        }
+        // redistribute edges so that new bins have equal weight
+        const auto target{std::accumulate(weight.cbegin(), weight.cend(), 0.) / NBin};
+        std::array<double, NBin + 1> newEdge;
+        newEdge.front() = 0;
+        newEdge.back() = 1;
+        int k{-1};
+        auto accumulated{0.};
+        for (int i{1}; i < NBin; ++i) {
+            while (accumulated < target and k < NBin - 1) {
+                accumulated += weight[++k];
+            }
+            accumulated -= target;
+            newEdge[i] = weight[k] > 0 ? edge[k + 1] - (edge[k + 1] - edge[k]) * std::max(0., accumulated) / weight[k] :
+                                         edge[k + 1];
+        }
+        std::ranges::copy(newEdge, edge);
+    }
+    fAccumulator.fill(0);
+}
+
+} // namespace Mustard::inline Math
@@ -0,0 +1,62 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Mustard::inline Math::internal {
+
+/// @brief Primitive polynomial and initial direction numbers of a Sobol
+/// sequence dimension. The polynomial is x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1,
+/// with a = (a_1 ... a_(s-1)) in binary.
+struct SobolDirectionNumber {
+    int s;
+    std::uint32_t a;
+    std::array<std::uint32_t, 7> m;
+};
+
+/// @brief Direction numbers of dimensions 2--21 from
+///   S. Joe and F. Y. Kuo, Constructing Sobol sequences with better
+///   two-dimensional projections, SIAM J. Sci. Comput. 30 (2008) 2635
+/// (new-joe-kuo-6.21201). Dimension 1 is the van der Corput sequence.
+inline constexpr std::array<SobolDirectionNumber, 20> gSobolDirectionNumber{{
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+}};
+
+} // namespace Mustard::inline Math::internal
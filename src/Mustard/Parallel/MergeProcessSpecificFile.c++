@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/MergeProcessSpecificFile.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+
+#include "TFileMerger.h"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace Mustard::Parallel {
+
+namespace {
+
+// Merge source into target, then remove source
+auto MergeFilePair(const std::filesystem::path& target, const std::filesystem::path& source) -> void {
+    const auto merged{std::filesystem::path{target}.concat(".merging")};
+    TFileMerger merger{/*isLocal =*/false};
+    merger.SetFastMethod(true);
+    merger.SetPrintLevel(0);
+    if (not merger.OutputFile(merged.generic_string().c_str(), "RECREATE")) {
+        Throw<std::runtime_error>(fmt::format("Cannot create '{}'", merged));
+    }
+    if (not merger.AddFile(target.generic_string().c_str(), false) or
+        not merger.AddFile(source.generic_string().c_str(), false)) {
+        Throw<std::runtime_error>(fmt::format("Cannot open '{}' or '{}' for merging", target, source));
+    }
+    if (not merger.Merge()) {
+        Throw<std::runtime_error>(fmt::format("Failed to merge '{}' into '{}'", source, target));
+    }
+    std::filesystem::rename(merged, target);
+    std::filesystem::remove(source);
+}
+
+// ROOT file modes are case-insensitive
+auto UpperCase(std::string_view mode) -> std::string {
+    std::string upper(mode);
+    std::ranges::transform(upper, upper.begin(), [](unsigned char c) { return std::toupper(c); });
+    return upper;
+}
+
+// Move source to target, or merge it into target if target exists and mode is "UPDATE".
+// With "RECREATE" an existing target is replaced, with "NEW"/"CREATE" it is an error.
+auto MoveOrMergeFile(const std::filesystem::path& target, const std::filesystem::path& source, std::string_view mode) -> void {
+    if (std::filesystem::exists(target)) {
+        if (const auto upperMode{UpperCase(mode)};
+            upperMode == "RECREATE") {
+            std::filesystem::remove(target);
+        } else if (upperMode == "UPDATE") {
+            MergeFilePair(target, source);
+            return;
+        } else {
+            Throw<std::runtime_error>(fmt::format("'{}' already exists (file mode '{}')", target, mode));
+        }
+    }
+    std::filesystem::rename(source, target);
+}
+
+// Tree reduction, result in the file of rank 0 of comm.
+// A failed process keeps taking part in the reduction (so that no partner
+// is left waiting), and passes the failure up the tree.
+auto TreeReduceMerge(const mplr::communicator& comm, const std::filesystem::path& file, std::exception_ptr& error) -> void {
+    for (int stride{1}; stride < comm.size(); stride *= 2) {
+        if (comm.rank() % (2 * stride) == 0) {
+            const auto partner{comm.rank() + stride};
+            if (partner >= comm.size()) {
+                continue;
+            }
+            // partner sends its file path when the file is ready, or an empty path if it failed
+            std::size_t pathSize;
+            comm.recv(pathSize, partner);
+            std::vector<char> partnerFile(pathSize);
+            comm.recv(partnerFile.data(), mplr::vector_layout<char>{pathSize}, partner);
+            if (error) {
+                continue;
+            }
+            if (pathSize == 0) {
+                error = std::make_exception_ptr(std::runtime_error{fmt::format("Merging failed on a partner of '{}'", file)});
+                continue;
+            }
+            try {
+                MergeFilePair(file, std::string{partnerFile.cbegin(), partnerFile.cend()});
+            } catch (...) {
+                error = std::current_exception();
+            }
+        } else {
+            const auto fileName{error ? std::string{} : file.generic_string()};
+            const auto pathSize{fileName.size()};
+            comm.send(pathSize, comm.rank() - stride);
+            comm.send(fileName.data(), mplr::vector_layout<char>{pathSize}, comm.rank() - stride);
+            return;
+        }
+    }
+}
+
+} // namespace
+
+auto MergeProcessSpecificFile(const std::filesystem::path& path, MergeLevel level, std::string_view mode) -> std::filesystem::path {
+    const auto processSpecificPath{ProcessSpecificPath(path)};
+    if (processSpecificPath == path) {
+        return path;
+    }
+
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto& intraNodeComm{mpiEnv.IntraNodeComm()};
+    const auto nodeDirectory{processSpecificPath.parent_path()};
+    const auto nodeFile{nodeDirectory / path.filename()};
+    std::exception_ptr error;
+    const auto TryMoveOrMerge{[&error](const auto& target, const auto& source, std::string_view targetMode) {
+        if (error) {
+            return;
+        }
+        try {
+            MoveOrMergeFile(target, source, targetMode);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }};
+
+    // merge files of this node
+    TreeReduceMerge(intraNodeComm, processSpecificPath, error);
+    if (intraNodeComm.rank() == 0) {
+        // the node file is the final output only with MergeLevel::Node
+        TryMoveOrMerge(nodeFile, processSpecificPath, level == MergeLevel::Node ? mode : "UPDATE");
+    }
+
+    // merge files of all nodes
+    if (level == MergeLevel::Job) {
+        if (const auto& interNodeComm{mpiEnv.InterNodeComm()};
+            interNodeComm.is_valid()) {
+            TreeReduceMerge(interNodeComm, nodeFile, error);
+            if (interNodeComm.rank() == 0) {
+                TryMoveOrMerge(path, nodeFile, mode);
+            }
+            std::error_code ec; // leave non-empty directories
+            std::filesystem::remove(nodeDirectory, ec);
+            interNodeComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+            if (interNodeComm.rank() == 0 and mpiEnv.OnCluster()) {
+                std::filesystem::remove(nodeDirectory.parent_path(), ec);
+            }
+        }
+    }
+    mplr::comm_world().ibarrier().wait(mplr::duty_ratio::preset::moderate);
+
+    // fail on all processes if any failed
+    auto failed{static_cast<int>(static_cast<bool>(error))};
+    mplr::comm_world().allreduce(mplr::max<int>{}, failed);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if (failed) {
+        Throw<std::runtime_error>(fmt::format("Failed to merge process-specific files of '{}' on another process", path));
+    }
+    return level == MergeLevel::Node ? nodeFile : path;
+}
+
+} // namespace Mustard::Parallel
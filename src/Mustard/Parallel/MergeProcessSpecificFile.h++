@@ -0,0 +1,60 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+namespace Mustard::Parallel {
+
+/// @brief Level of merging process-specific files
+enum struct MergeLevel {
+    Node, ///< One file per node
+    Job   ///< One file for all processes
+};
+
+/// @brief Merges files written by all processes at Mustard::Parallel::ProcessSpecificPath(path)
+///
+/// Files are merged by a binary tree reduction: in each round, half of the remaining
+/// processes merge the file of a partner into their own (fast-cloning tree baskets),
+/// so that merging takes log2(#processes) rounds instead of one sequential pass.
+/// Processes on a node are merged first, then nodes (for MergeLevel::Job).
+/// Merged files are removed. If the target file already exists (e.g. from a
+/// previous run), mode decides what happens, in the same way as the ROOT file
+/// mode: "UPDATE" merges new data into it, "RECREATE" replaces it, and
+/// "NEW"/"CREATE" fail.
+///
+/// @param path Original file path passed to ProcessSpecificPath
+/// @param level Merge into one file per node or one file for the job
+/// @param mode How to treat an existing target file ("UPDATE", "RECREATE", "NEW" or "CREATE")
+///
+/// @return Path of the merged file containing data of this process:
+///          - MergeLevel::Job: path
+///          - MergeLevel::Node: path with filename placed in the node-specific
+///            directory of ProcessSpecificPath
+///
+/// @throws std::runtime_error If ROOT fails to merge files, or the target
+///         exists in "NEW"/"CREATE" mode. Thrown on all processes if any fails.
+///
+/// @warning This is an MPI collective operation (must be called by all processes),
+///          and all process-specific files must have been closed.
+auto MergeProcessSpecificFile(const std::filesystem::path& path, MergeLevel level = MergeLevel::Job,
+                              std::string_view mode = "UPDATE") -> std::filesystem::path;
+
+} // namespace Mustard::Parallel
@@ -29,6 +29,8 @@
 
 #include "Eigen/Cholesky"
 
+#include "mplr/mplr.hpp"
+
 #include "muc/math"
 #include "muc/numeric"
 
@@ -36,7 +38,10 @@
 #include <array>
 #include <cmath>
 #include <concepts>
+#include <functional>
+#include <istream>
 #include <optional>
+#include <ostream>
 #include <utility>
 
 namespace Mustard::inline Physics::inline Generator {
@@ -100,6 +105,12 @@ private:
     /// @brief Markov chain burn in stage
     /// @param rng Reference to CLHEP random engine
     virtual auto BurnIn(CLHEP::HepRandomEngine& rng) -> void override;
+    /// @brief Pool adapted proposal covariance over processes
+    virtual auto PoolBurnIn() -> void override;
+    /// @brief Save adapted proposal
+    virtual auto SaveSamplerState(std::ostream& os) const -> void override;
+    /// @brief Restore adapted proposal
+    virtual auto RestoreSamplerState(std::istream& is) -> void override;
     /// @brief Advance Markov chain by one event
     /// @param rng Reference to CLHEP random engine
     /// @return true if proposal accepted, false if not
@@ -57,9 +57,12 @@ auto AdaptiveMTMGenerator<M, N, A>::BurnIn(CLHEP::HepRandomEngine& rng) -> void
             distance += fgInitProposalStepSize;
         }
     }
-    // Then let's learn for a while
+    // Then let's learn for a while. Other chains share the proposal learnt by the first one
+    if (this->CurrentChain() != 0) {
+        return;
+    }
     fIteration = 1;
-    std::ranges::copy(this->fMC.state.u, fRunningMean.begin());
+    std::ranges::copy(this->MC().state.u, fRunningMean.begin());
     fProposalCovariance.setIdentity();
     fProposalCovariance *= muc::pow(fgInitProposalStepSize, 2);
     fProposalSigma.setIdentity();
@@ -69,6 +72,50 @@ auto AdaptiveMTMGenerator<M, N, A>::BurnIn(CLHEP::HepRandomEngine& rng) -> void
     } while (-fgLearningRatePower * fLearningRate > 1e-6 * fIteration); // delta fLearningRate > 1e-6
 }
 
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto AdaptiveMTMGenerator<M, N, A>::PoolBurnIn() -> void {
+    if (not mplr::available()) {
+        return;
+    }
+    // Pool running mean and covariance over processes (equal weights):
+    // mean = <mean_r>, cov = <cov_r + mean_r mean_r^T> - mean mean^T
+    const auto worldComm{mplr::comm_world()};
+    Eigen::Matrix<double, MarkovChain::dim, MarkovChain::dim> secondMoment{fProposalCovariance + fRunningMean * fRunningMean.transpose()};
+    worldComm.allreduce(std::plus<double>{}, fRunningMean.data(), mplr::contiguous_layout<double>{MarkovChain::dim});
+    worldComm.allreduce(std::plus<double>{}, secondMoment.data(), mplr::contiguous_layout<double>{MarkovChain::dim * MarkovChain::dim});
+    fRunningMean /= worldComm.size();
+    secondMoment /= worldComm.size();
+    fProposalCovariance = secondMoment - fRunningMean * fRunningMean.transpose();
+    fProposalSigma = Eigen::LDLT<decltype(fProposalCovariance)>{fProposalCovariance}.matrixL();
+    fProposalSigma *= fgScalingFactor;
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto AdaptiveMTMGenerator<M, N, A>::SaveSamplerState(std::ostream& os) const -> void {
+    Base::WriteBinary(os, fIteration);
+    Base::WriteBinary(os, fLearningRate);
+    os.write(reinterpret_cast<const char*>(fRunningMean.data()), fRunningMean.size() * sizeof(double));
+    os.write(reinterpret_cast<const char*>(fProposalCovariance.data()), fProposalCovariance.size() * sizeof(double));
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto AdaptiveMTMGenerator<M, N, A>::RestoreSamplerState(std::istream& is) -> void {
+    decltype(fIteration) iteration;
+    decltype(fLearningRate) learningRate;
+    decltype(fRunningMean) runningMean;
+    decltype(fProposalCovariance) proposalCovariance;
+    Base::ReadBinary(is, iteration);
+    Base::ReadBinary(is, learningRate);
+    is.read(reinterpret_cast<char*>(runningMean.data()), runningMean.size() * sizeof(double));
+    is.read(reinterpret_cast<char*>(proposalCovariance.data()), proposalCovariance.size() * sizeof(double));
+    fIteration = iteration;
+    fLearningRate = learningRate;
+    fRunningMean = runningMean;
+    fProposalCovariance = proposalCovariance;
+    fProposalSigma = Eigen::LDLT<decltype(fProposalCovariance)>{fProposalCovariance}.matrixL();
+    fProposalSigma *= fgScalingFactor;
+}
+
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
 auto AdaptiveMTMGenerator<M, N, A>::NextEventImpl(CLHEP::HepRandomEngine& rng, double burnInStepSize) -> bool {
     // Adaptive multiple-try Metropolis sampler (Ref: Simon Fontaine, Mylène Bédard (2022), https://doi.org/10.3150/21-BEJ1408)
@@ -102,7 +149,7 @@ auto AdaptiveMTMGenerator<M, N, A>::NextEventImpl(CLHEP::HepRandomEngine& rng, d
 
     // y_1, ..., y_k
     for (int i{}; i < fgNTrial; ++i) {
-        if (not ProposeState(this->fMC.state, stateY[i])) { // Draw y_i from T(x, *)
+        if (not ProposeState(this->MC().state, stateY[i])) { // Draw y_i from T(x, *)
             piY[i] = 0;
             continue;
         }
@@ -129,7 +176,7 @@ auto AdaptiveMTMGenerator<M, N, A>::NextEventImpl(CLHEP::HepRandomEngine& rng, d
     }()};
 
     // x_1, ..., x_k (note that x_k = x)
-    auto sumPiX{this->fMC.mSqAcceptanceDetJ}; // pi(x_1) + ... + pi(x_k)
+    auto sumPiX{this->MC().mSqAcceptanceDetJ}; // pi(x_1) + ... + pi(x_k)
     for (int i{}; i < fgNTrial - 1; ++i) {
         if (not ProposeState(stateY[selected], stateX)) { // Draw x_i from T(Y, *)
             continue;
@@ -146,17 +193,17 @@ auto AdaptiveMTMGenerator<M, N, A>::NextEventImpl(CLHEP::HepRandomEngine& rng, d
     const auto accepted{sumPiY >= sumPiX or
                         sumPiY > sumPiX * rng.flat()};
     if (accepted) {
-        this->fMC.state = stateY[selected];
-        this->fMC.mSqAcceptanceDetJ = piY[selected];
-        this->fMC.event = std::move(eventY[selected]);
-        this->fMC.event.weight = 1 / acceptanceY[selected];
+        this->MC().state = stateY[selected];
+        this->MC().mSqAcceptanceDetJ = piY[selected];
+        this->MC().event = std::move(eventY[selected]);
+        this->MC().event.weight = 1 / acceptanceY[selected];
     }
 
     // Adaptation
     if (not burnInStepSize) {
         ++fIteration;
         fLearningRate = std::pow(fIteration, fgLearningRatePower);
-        const auto deltaMu{(VectorCast<decltype(fRunningMean)>(this->fMC.state.u) - fRunningMean).eval()};
+        const auto deltaMu{(VectorCast<decltype(fRunningMean)>(this->MC().state.u) - fRunningMean).eval()};
         fRunningMean += fLearningRate * deltaMu;
         fProposalCovariance += fLearningRate * (deltaMu * deltaMu.transpose() - fProposalCovariance);
         fProposalSigma = Eigen::LDLT<decltype(fProposalCovariance)>{fProposalCovariance}.matrixL();
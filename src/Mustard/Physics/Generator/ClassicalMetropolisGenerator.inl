@@ -82,7 +82,7 @@ auto ClassicalMetropolisGenerator<M, N, A>::NextEvent(CLHEP::HepRandomEngine& rn
     }
     struct MarkovChain::State state;
     // Walk random state
-    std::ranges::transform(this->fMC.state.u, state.u.begin(), [&](auto u0) {
+    std::ranges::transform(this->MC().state.u, state.u.begin(), [&](auto u0) {
         return fGaussian(rng, {u0, fStepSize});
     });
     for (auto&& u : state.u) {
@@ -90,18 +90,18 @@ auto ClassicalMetropolisGenerator<M, N, A>::NextEvent(CLHEP::HepRandomEngine& rn
         u = u > 1 ? 2 - u : u;          // boundary
     }
     // Walk particle mapping if necessary
-    this->ProposePID(rng, this->fMC.state.pID, state.pID);
+    this->ProposePID(rng, this->MC().state.pID, state.pID);
     auto [event, detJ]{this->PhaseSpace(state)};
     bool accepted{};
     if (this->InfraredSafe(event.p)) {
         const auto acceptance{this->Acceptance(event.p)};
         const auto mSqAcceptanceDetJ{this->MSqAcceptanceDetJ(event.p, acceptance, detJ)};
-        if (mSqAcceptanceDetJ >= this->fMC.mSqAcceptanceDetJ or
-            mSqAcceptanceDetJ > this->fMC.mSqAcceptanceDetJ * rng.flat()) {
-            this->fMC.state = std::move(state);
-            this->fMC.mSqAcceptanceDetJ = mSqAcceptanceDetJ;
-            this->fMC.event = std::move(event);
-            this->fMC.event.weight = 1 / acceptance;
+        if (mSqAcceptanceDetJ >= this->MC().mSqAcceptanceDetJ or
+            mSqAcceptanceDetJ > this->MC().mSqAcceptanceDetJ * rng.flat()) {
+            this->MC().state = std::move(state);
+            this->MC().mSqAcceptanceDetJ = mSqAcceptanceDetJ;
+            this->MC().event = std::move(event);
+            this->MC().event.weight = 1 / acceptance;
             accepted = true;
         }
     }
@@ -45,6 +45,11 @@ M2ENNEEGenerator::M2ENNEEGenerator(std::string_view parent, Vector3D momentum, V
     AddIdenticalSet({0, 4});
 }
 
+auto M2ENNEEGenerator::MSqVersion(QFT::MSqM2ENNEE::Ver mSqVer) -> void {
+    fMatrixElement.Version(mSqVer);
+    MCMCInitializationRequired();
+}
+
 auto M2ENNEEGenerator::Parent(std::string_view parent) -> void {
     if (parent == "mu-") {
         PDGID({11, -12, 14, -11, 11});
@@ -47,7 +47,8 @@ public:
 
     /// @brief Set matrix element version
     /// @param mSqVer The matrix element version
-    auto MSqVersion(QFT::MSqM2ENNEE::Ver mSqVer) -> void { fMatrixElement.Version(mSqVer); }
+    /// @warning The Markov chain requires reinitialize after set
+    auto MSqVersion(QFT::MSqM2ENNEE::Ver mSqVer) -> void;
 
     /// @brief Set parent particle
     /// @param parent "mu-" or "mu+"
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/IO/File.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Math/Vector.h++"
 #include "Mustard/Parallel/ReseedRandomEngine.h++"
@@ -32,6 +33,7 @@
 #include "CLHEP/Random/RandomEngine.h"
 
 #include "Eigen/Dense"
+#include "unsupported/Eigen/FFT"
 
 #include "mplr/mplr.hpp"
 
@@ -48,12 +50,23 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
+#include <complex>
 #include <concepts>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
 #include <functional>
+#include <istream>
 #include <limits>
 #include <optional>
+#include <ostream>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -70,6 +83,11 @@ namespace Mustard::inline Physics::inline Generator {
 /// initial-state momenta. So this generator is unsuitable
 /// for case where frequent variation of initial-state momenta is required.
 ///
+/// Several independent chains can be run in each process (see `NChain`).
+/// Events are then drawn from the chains in turn. Burn-in statistics and the
+/// autocorrelation estimate are pooled over all chains of all processes, so
+/// thinning is decided once collectively.
+///
 /// @tparam M Number of initial-state particles
 /// @tparam N Number of final-state particles
 /// @tparam A Matrix element of the process to be generated
@@ -163,8 +181,13 @@ public:
     /// @param value Thinning factor (>=0)
     auto ThinningRatio(double value) -> void;
     /// @brief Set sample size for estimation autocorrelation function (ACF)
-    /// @param n Sample size
+    /// The sample is split evenly over all chains of all processes.
+    /// @param n Total sample size
     auto ACFSampleSize(unsigned n) -> void;
+    /// @brief Set number of independent Markov chains in this process
+    /// @param n Number of chains (>0)
+    /// @warning The Markov chain requires reinitialize after set
+    auto NChain(unsigned n) -> void;
 
     /// @brief Return true if Markov chain initialized
     /// @return true if initialized
@@ -173,6 +196,22 @@ public:
     /// @param rng Reference to CLHEP random engine
     auto MCMCInitialize(CLHEP::HepRandomEngine& rng = *CLHEP::HepRandom::getTheEngine()) -> AutocorrelationFunction;
 
+    /// @brief Save initialized Markov chains (states, thinning and sampler adaptation)
+    /// to a process-specific binary file
+    /// @param fileName File path
+    /// @warning This is an MPI collective operation
+    auto SaveMCMCState(const std::filesystem::path& fileName) const -> void;
+    /// @brief Restore Markov chains saved by `SaveMCMCState`, skipping `MCMCInitialize`
+    /// @param fileName File path
+    /// @param rng Reference to CLHEP random engine, reseeded if restored
+    /// @return true if restored on all processes. false if the file of any process cannot
+    /// be read or was saved for another generator configuration, in which case nothing
+    /// is changed on any process
+    /// @note The user-defined acceptance is not checked, it should be the same as when saved
+    /// @warning This is an MPI collective operation
+    auto RestoreMCMCState(const std::filesystem::path& fileName,
+                          CLHEP::HepRandomEngine& rng = *CLHEP::HepRandom::getTheEngine()) -> bool;
+
     /// @brief Generate event in c.m. frame
     /// @param rng Reference to CLHEP random engine
     /// @return Generated event
@@ -208,6 +247,16 @@ protected:
     /// @brief Notify MCMC that reinitialize is required
     auto MCMCInitializationRequired() -> void;
 
+    /// @brief Get current Markov chain
+    auto MC() -> MarkovChain& { return fChain[fCurrentChain]; }
+    /// @brief Get index of current Markov chain (0 ≤ index < number of chains)
+    auto CurrentChain() const -> auto { return fCurrentChain; }
+
+    /// @brief Write a trivially copyable object to binary stream
+    static auto WriteBinary(std::ostream& os, const auto& x) -> void { os.write(reinterpret_cast<const char*>(&x), sizeof(x)); }
+    /// @brief Read a trivially copyable object from binary stream
+    static auto ReadBinary(std::istream& is, auto& x) -> void { is.read(reinterpret_cast<char*>(&x), sizeof(x)); }
+
     /// @brief Transform hypercube to phase space
     /// @param u A random state
     /// @return An event from phase space and detJ
@@ -227,7 +276,15 @@ protected:
 private:
     /// @brief Markov chain burn in stage
     /// @param rng Reference to CLHEP random engine
+    /// @note Called once for each chain, with the chain set as current chain
     virtual auto BurnIn(CLHEP::HepRandomEngine& rng) -> void = 0;
+    /// @brief Pool burn-in statistics (e.g. adapted proposal) over processes.
+    /// Called collectively after all chains burnt in. Does nothing by default
+    virtual auto PoolBurnIn() -> void {}
+    /// @brief Save sampler-specific state (e.g. adapted proposal). Does nothing by default
+    virtual auto SaveSamplerState(std::ostream&) const -> void {}
+    /// @brief Restore sampler-specific state saved by `SaveSamplerState`. Does nothing by default
+    virtual auto RestoreSamplerState(std::istream&) -> void {}
     /// @brief Advance Markov chain by one event
     /// @param rng Reference to CLHEP random engine
     /// @return true if proposal accepted, false if not
@@ -236,12 +293,17 @@ private:
 protected:
     double fThinningRatio;   ///< User-defined thinning ratio
     unsigned fACFSampleSize; ///< Sample size for estimating ACF
+    unsigned fNChain;        ///< Number of chains in this process
                              //
     bool fMCMCInitialized;   ///< Initialization completed flag
-    unsigned fThinningSize;  ///< Samples discarded between two generated
-    MarkovChain fMC;         ///< Current Markov chain state
+    unsigned fThinningSize;  ///< Samples discarded between two generated (in each chain)
+                             //
+    std::vector<MarkovChain> fChain; ///< Markov chain states
+    unsigned fCurrentChain;          ///< Index of current Markov chain
 
     static constexpr auto fgDefaultInvalidACFSampleSize{static_cast<decltype(fACFSampleSize)>(-1)};
+    static constexpr std::uint32_t fgMCMCStateMagic{0x434d434d}; ///< "MCMC"
+    static constexpr std::uint32_t fgMCMCStateVersion{1};
 };
 
 } // namespace Mustard::inline Physics::inline Generator
@@ -24,9 +24,11 @@ MCMCGenerator<M, N, A>::MCMCGenerator(const InitialStateMomenta& pI, const std::
     Base{pI, pdgID, mass},
     fThinningRatio{1.5},
     fACFSampleSize{fgDefaultInvalidACFSampleSize},
+    fNChain{1},
     fMCMCInitialized{},
     fThinningSize{},
-    fMC{} {
+    fChain(1),
+    fCurrentChain{} {
     if (thinningRatio) {
         ThinningRatio(*thinningRatio);
     }
@@ -115,6 +117,21 @@ auto MCMCGenerator<M, N, A>::ACFSampleSize(unsigned n) -> void {
     fACFSampleSize = n;
 }
 
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MCMCGenerator<M, N, A>::NChain(unsigned n) -> void {
+    if (n == 0) {
+        PrintError("Zero number of Markov chains not allowed, not setting it");
+        return;
+    }
+    if (n > 1000) [[unlikely]] {
+        PrintWarning(fmt::format("Suspicious number of Markov chains (got {})", n));
+    }
+    if (n != fNChain) {
+        MCMCInitializationRequired();
+    }
+    fNChain = n;
+}
+
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
 auto MCMCGenerator<M, N, A>::MCMCInitialize(CLHEP::HepRandomEngine& rng) -> AutocorrelationFunction {
     if (fACFSampleSize == fgDefaultInvalidACFSampleSize) {
@@ -128,40 +145,50 @@ auto MCMCGenerator<M, N, A>::MCMCInitialize(CLHEP::HepRandomEngine& rng) -> Auto
     // Reseed random engine for statistical safety
     Parallel::ReseedRandomEngine(&rng);
 
-    // find phase space
-    MasterPrintLn("Finding phase space...");
-    muc::ranges::iota(fMC.state.pID, 0);
-    for (long long counter{};; ++counter) {
-        if (counter >= 1'000'000'000) {
-            const auto billion{std::div(counter, 1'000'000'000ll)};
-            if (billion.rem == 0) [[unlikely]] {
-                PrintWarning(fmt::format("Tried {} billion times to find phase space in {} initialization, still trying...", billion.quot, thisName));
+    fChain.assign(fNChain, {});
+    for (fCurrentChain = 0; fCurrentChain < fChain.size(); ++fCurrentChain) {
+        if (fChain.size() > 1) {
+            MasterPrintLn("Markov chain #{}:", fCurrentChain);
+        }
+
+        // find phase space
+        MasterPrintLn("Finding phase space...");
+        auto& mc{MC()};
+        muc::ranges::iota(mc.state.pID, 0);
+        for (long long counter{};; ++counter) {
+            if (counter >= 1'000'000'000) {
+                const auto billion{std::div(counter, 1'000'000'000ll)};
+                if (billion.rem == 0) [[unlikely]] {
+                    PrintWarning(fmt::format("Tried {} billion times to find phase space in {} initialization, still trying...", billion.quot, thisName));
+                }
+                if (billion.quot == 1000) {
+                    Throw<std::runtime_error>(fmt::format("Failed to find phase space after 1 trillion tries in {} initialization", thisName));
+                }
             }
-            if (billion.quot == 1000) {
-                Throw<std::runtime_error>(fmt::format("Failed to find phase space after 1 trillion tries in {} initialization", thisName));
+            rng.flatArray(mc.state.u.size(), mc.state.u.data());
+            auto [event, detJ]{DirectPhaseSpace(mc.state.u)};
+            if (not this->InfraredSafe(event.p)) {
+                continue;
             }
+            const auto acceptance{this->Acceptance(event.p)};
+            const auto mSqAcceptanceDetJ{this->MSqAcceptanceDetJ(event.p, acceptance, detJ)};
+            if (mSqAcceptanceDetJ <= std::numeric_limits<double>::min()) {
+                continue;
+            }
+            mc.mSqAcceptanceDetJ = mSqAcceptanceDetJ;
+            mc.event = std::move(event);
+            mc.event.weight = 1 / acceptance;
+            break;
         }
-        rng.flatArray(fMC.state.u.size(), fMC.state.u.data());
-        auto [event, detJ]{DirectPhaseSpace(fMC.state.u)};
-        if (not this->InfraredSafe(event.p)) {
-            continue;
-        }
-        const auto acceptance{this->Acceptance(event.p)};
-        const auto mSqAcceptanceDetJ{this->MSqAcceptanceDetJ(event.p, acceptance, detJ)};
-        if (mSqAcceptanceDetJ <= std::numeric_limits<double>::min()) {
-            continue;
-        }
-        fMC.mSqAcceptanceDetJ = mSqAcceptanceDetJ;
-        fMC.event = std::move(event);
-        fMC.event.weight = 1 / acceptance;
-        break;
-    }
-    MasterPrintLn("Phase space found.");
+        MasterPrintLn("Phase space found.");
 
-    // Burning in
-    MasterPrintLn("Markov chain burning in...");
-    BurnIn(rng);
-    MasterPrintLn("Markov chain burnt in.");
+        // Burning in
+        MasterPrintLn("Markov chain burning in...");
+        BurnIn(rng);
+        MasterPrintLn("Markov chain burnt in.");
+    }
+    fCurrentChain = 0;
+    PoolBurnIn();
 
     if (Env::VerboseLevelReach<'I'>()) {
         struct {
@@ -197,79 +224,104 @@ auto MCMCGenerator<M, N, A>::MCMCInitialize(CLHEP::HepRandomEngine& rng) -> Auto
     MasterPrintLn("Estimating autocorrelation and decide thinning...");
     using ArrayDimMC = Eigen::Array<double, MarkovChain::dim, 1>;
 
-    std::vector<ArrayDimMC> sample(fACFSampleSize);
-    for (unsigned i{}; i < fACFSampleSize; ++i) {
-        NextEvent(rng);
-        std::ranges::copy(fMC.state.u, sample[i].begin());
+    // Each chain of each process contributes an equal share of the sample. Moments are
+    // summed over chains and processes, so that all processes get the same pooled ACF
+    const auto nChain{static_cast<unsigned>(fChain.size())};
+    auto nChainTotal{nChain};
+    if (mplr::available()) {
+        mplr::comm_world().allreduce(std::plus<unsigned>{}, nChainTotal);
     }
+    const auto sampleSize{std::max(2u, (fACFSampleSize + nChainTotal - 1) / nChainTotal)};
+    std::vector<std::vector<ArrayDimMC>> sample(fChain.size(), std::vector<ArrayDimMC>(sampleSize));
+    for (fCurrentChain = 0; fCurrentChain < fChain.size(); ++fCurrentChain) {
+        for (auto&& x : sample[fCurrentChain]) {
+            NextEvent(rng);
+            std::ranges::copy(MC().state.u, x.begin());
+        }
+    }
+    fCurrentChain = 0;
+    const auto AllreduceSum{[](ArrayDimMC* data, std::size_t n) {
+        if (mplr::available()) {
+            mplr::comm_world().allreduce(std::plus<double>{}, data->data(), mplr::contiguous_layout<double>{n * MarkovChain::dim});
+        }
+    }};
+
     ArrayDimMC sampleMean;
     sampleMean.setZero();
-    for (auto&& x : sample) {
-        sampleMean += x;
+    for (auto&& chainSample : sample) {
+        for (auto&& x : chainSample) {
+            sampleMean += x;
+        }
+    }
+    AllreduceSum(&sampleMean, 1);
+    sampleMean /= static_cast<double>(sampleSize) * nChainTotal;
+
+    // Autocovariance sums of all lags by FFT (Wiener-Khinchin theorem), zero-padded against wrap-around. O(n log n)
+    const auto maxLag{sampleSize / 2};
+    const auto nFFT{std::bit_ceil(2 * sampleSize)};
+    Eigen::FFT<double> fft;
+    std::vector<double> series(nFFT);
+    std::vector<std::complex<double>> spectrum;
+    std::vector<double> autocovariance;
+    std::vector<ArrayDimMC> autocorrelationNumerator(maxLag + 1, ArrayDimMC::Zero());
+    for (auto&& chainSample : sample) {
+        for (int k{}; k < MarkovChain::dim; ++k) {
+            std::ranges::transform(chainSample, series.begin(), [&](auto&& x) { return x[k] - sampleMean[k]; });
+            std::fill(series.begin() + sampleSize, series.end(), 0);
+            fft.fwd(spectrum, series);
+            for (auto&& z : spectrum) {
+                z = std::norm(z);
+            }
+            fft.inv(autocovariance, spectrum, nFFT);
+            for (unsigned lag{}; lag <= maxLag; ++lag) {
+                autocorrelationNumerator[lag][k] += autocovariance[lag];
+            }
+        }
     }
-    sampleMean /= fACFSampleSize;
-    ArrayDimMC autocorrelationDenominator;
-    autocorrelationDenominator.setZero();
-    for (auto&& x : sample) {
-        const auto delta{(x - sampleMean).eval()};
-        autocorrelationDenominator += delta * delta;
+    AllreduceSum(autocorrelationNumerator.data(), autocorrelationNumerator.size());
+    const auto autocorrelationDenominator{autocorrelationNumerator.front()};
+    std::vector<ArrayDimMC> autocorrelation;
+    autocorrelation.reserve(autocorrelationNumerator.size());
+    for (auto&& numerator : std::as_const(autocorrelationNumerator)) {
+        autocorrelation.emplace_back(numerator / autocorrelationDenominator);
     }
 
-    const auto maxLag{fACFSampleSize / 2};
+    // Returned ACF curve has at most ~1000 points
     const auto deltaLag{std::max(1u, maxLag / 1000)};
     AutocorrelationFunction autocorrelationFunction;
-    autocorrelationFunction.reserve(maxLag / deltaLag + 2);
-    autocorrelationFunction.emplace_back(0, ArrayDimMC::Ones());
-    for (auto lag{deltaLag}; lag <= maxLag; lag += deltaLag) {
-        ArrayDimMC autocorrelationNumerator;
-        autocorrelationNumerator.setZero();
-        for (unsigned i{}; i < fACFSampleSize - lag; ++i) {
-            autocorrelationNumerator += (sample[i] - sampleMean) * (sample[i + lag] - sampleMean);
-        }
-        autocorrelationFunction.emplace_back(lag, autocorrelationNumerator / autocorrelationDenominator);
+    autocorrelationFunction.reserve(maxLag / deltaLag + 1);
+    for (unsigned lag{}; lag <= maxLag; lag += deltaLag) {
+        autocorrelationFunction.emplace_back(lag, autocorrelation[lag]);
     }
 
-    ArrayDimMC sumAutocorrelation;
-    sumAutocorrelation.setZero();
+    // Integrated autocorrelation time by Sokal's automatic windowing (A. Sokal, Monte Carlo Methods in Statistical Mechanics (1997)):
+    // tau(W) = 1 + 2 sum(rho_lag,1,W), with the smallest window W such that W >= c tau(W)
+    constexpr auto windowFactor{5};
+    ArrayDimMC integratedAutocorrelationK;
     std::array<bool, MarkovChain::dim> autocorrelationConverged{};
-    auto lastAutocorrelation{&autocorrelationFunction.front().second};
-    for (auto&& [lag, autocorrelation] : autocorrelationFunction) {
-        if (lag == 0) {
-            continue;
-        }
-        for (int k{}; k < MarkovChain::dim; ++k) {
-            if (autocorrelationConverged[k]) {
-                continue;
-            }
-            if (autocorrelation[k] < 0) {
+    for (int k{}; k < MarkovChain::dim; ++k) {
+        auto& tau{integratedAutocorrelationK[k]};
+        tau = 1;
+        for (unsigned lag{1}; lag <= maxLag; ++lag) {
+            tau += 2 * autocorrelation[lag][k];
+            if (lag >= windowFactor * tau) {
                 autocorrelationConverged[k] = true;
+                break;
             }
-            sumAutocorrelation[k] += ((*lastAutocorrelation)[k] + autocorrelation[k]) / 2 * deltaLag +
-                                     ((*lastAutocorrelation)[k] - autocorrelation[k]) / 2; // approximate sum
         }
-        lastAutocorrelation = &autocorrelation;
     }
     if (not std::ranges::all_of(autocorrelationConverged, [](auto c) { return c; })) {
         PrintWarning(fmt::format("Autocorrelation not converged. Try increasing ACF sample size (current: {}). "
                                  "Generated events may be highly correlated.",
                                  fACFSampleSize));
     }
-
-    double meanSumAutocorrelation{};
-    for (auto&& rho : std::as_const(sumAutocorrelation)) {
-        meanSumAutocorrelation += muc::pow(rho, 2);
-    }
-    meanSumAutocorrelation = std::sqrt(meanSumAutocorrelation / sumAutocorrelation.size());
-    if (mplr::available()) {
-        const auto worldComm{mplr::comm_world()};
-        worldComm.iallreduce(std::plus{}, meanSumAutocorrelation).wait(mplr::duty_ratio::preset::relaxed);
-        meanSumAutocorrelation /= worldComm.size();
-    }
-    // Here sumAutocorrelation = sum(rho_k,0,inf) = sum(rho_k,1,inf)+1,
-    // So N_eff = N/(1+2*sum(rho_k,1,inf)) = N/(2*sum(rho_k,0,inf)-1) => int. ac. = 2*sum(rho_k,0,inf)-1
-    const auto integratedAutocorrelation{2 * meanSumAutocorrelation - 1};
+    const auto integratedAutocorrelation{std::sqrt(integratedAutocorrelationK.square().mean())};
     MasterPrintLn("Approximate mean integrated autocorrelation: {:.2f}.", integratedAutocorrelation);
     fThinningSize = fThinningRatio * integratedAutocorrelation;
+    if (mplr::available()) {
+        // The ACF is identical on all processes, broadcast anyway to rule out rounding differences
+        mplr::comm_world().bcast(0, fThinningSize);
+    }
     MasterPrintLn("Thinning Markov chain by 1/{}.", fThinningSize + 1);
 
     fMCMCInitialized = true;
@@ -283,17 +335,132 @@ auto MCMCGenerator<M, N, A>::MCMCInitialize(CLHEP::HepRandomEngine& rng) -> Auto
     return autocorrelationFunction;
 }
 
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MCMCGenerator<M, N, A>::SaveMCMCState(const std::filesystem::path& fileName) const -> void {
+    if (not fMCMCInitialized) [[unlikely]] {
+        PrintWarning(fmt::format("Markov chain not initialized, nothing saved to '{}'", fileName.generic_string()));
+        return;
+    }
+    ProcessSpecificFile<std::ofstream> file{fileName, std::ios::out | std::ios::binary | std::ios::trunc};
+    if (not file.Opened()) [[unlikely]] {
+        PrintError(fmt::format("Cannot open '{}', Markov chain state not saved", file.Path()));
+        return;
+    }
+    try {
+        auto& os{*file};
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        const auto signature{fmt::format("{};{}", muc::try_demangle(typeid(*this).name()), this->ConfigurationSignature())};
+        WriteBinary(os, fgMCMCStateMagic);
+        WriteBinary(os, fgMCMCStateVersion);
+        WriteBinary(os, static_cast<std::uint64_t>(signature.size()));
+        os.write(signature.data(), signature.size());
+        WriteBinary(os, static_cast<std::uint32_t>(fChain.size()));
+        WriteBinary(os, fThinningSize);
+        WriteBinary(os, fCurrentChain);
+        for (auto&& mc : fChain) {
+            WriteBinary(os, mc.state.u);
+            WriteBinary(os, mc.state.pID);
+            WriteBinary(os, mc.mSqAcceptanceDetJ);
+        }
+        SaveSamplerState(os);
+    } catch (const std::exception& e) {
+        PrintError(fmt::format("Markov chain state cannot be saved to '{}' ({})", file.Path(), e.what()));
+    }
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MCMCGenerator<M, N, A>::RestoreMCMCState(const std::filesystem::path& fileName, CLHEP::HepRandomEngine& rng) -> bool {
+    // Sampler state is restored in place, keep a copy in case other processes fail
+    std::stringstream samplerBackup;
+    SaveSamplerState(samplerBackup);
+
+    std::vector<MarkovChain> chain;
+    unsigned thinningSize;
+    unsigned currentChain;
+    ProcessSpecificFile<std::ifstream> file{fileName, std::ios::in | std::ios::binary};
+    const auto Read{[&]() -> bool {
+        if (not file.Opened()) [[unlikely]] {
+            PrintWarning(fmt::format("Cannot open '{}', Markov chain state not restored", file.Path()));
+            return false;
+        }
+        try {
+            auto& is{*file};
+            is.exceptions(std::ios::failbit | std::ios::badbit);
+            std::uint32_t magic;
+            std::uint32_t version;
+            ReadBinary(is, magic);
+            ReadBinary(is, version);
+            if (magic != fgMCMCStateMagic or version != fgMCMCStateVersion) {
+                PrintWarning(fmt::format("'{}' is not a Markov chain state file of known format, not restored", file.Path()));
+                return false;
+            }
+            std::uint64_t signatureSize;
+            ReadBinary(is, signatureSize);
+            std::string storedSignature(signatureSize, '\0');
+            is.read(storedSignature.data(), storedSignature.size());
+            std::uint32_t nChain;
+            ReadBinary(is, nChain);
+            const auto signature{fmt::format("{};{}", muc::try_demangle(typeid(*this).name()), this->ConfigurationSignature())};
+            if (storedSignature != signature or nChain != fNChain) {
+                PrintWarning(fmt::format("Markov chain state in '{}' was saved for another configuration, not restored", file.Path()));
+                return false;
+            }
+            ReadBinary(is, thinningSize);
+            ReadBinary(is, currentChain);
+            chain.resize(nChain);
+            for (auto&& mc : chain) {
+                ReadBinary(is, mc.state.u);
+                ReadBinary(is, mc.state.pID);
+                ReadBinary(is, mc.mSqAcceptanceDetJ);
+                double detJ;
+                std::tie(mc.event, detJ) = PhaseSpace(mc.state);
+                mc.event.weight = 1 / this->Acceptance(mc.event.p);
+            }
+            RestoreSamplerState(is);
+        } catch (const std::exception& e) {
+            PrintWarning(fmt::format("Markov chain state cannot be restored from '{}' ({})", file.Path(), e.what()));
+            return false;
+        }
+        return true;
+    }};
+    const auto restored{Read()};
+
+    // Commit only if all processes succeeded, so that either all of them use the restored
+    // state or all of them (re)initialize, which is collective
+    auto allRestored{static_cast<int>(restored)};
+    if (mplr::available()) {
+        mplr::comm_world().allreduce(mplr::min<int>{}, allRestored);
+    }
+    if (not allRestored) {
+        if (restored) {
+            RestoreSamplerState(samplerBackup);
+            PrintWarning(fmt::format("Markov chain state in '{}' not restored since it failed on other processes", file.Path()));
+        }
+        return false;
+    }
+    fChain = std::move(chain);
+    fCurrentChain = currentChain % fChain.size();
+    fThinningSize = thinningSize;
+    fMCMCInitialized = true;
+    // Reseed random engine for statistical safety, as MCMCInitialize does
+    Parallel::ReseedRandomEngine(&rng);
+    MasterPrintLn("{} restored from '{}'.", muc::try_demangle(typeid(*this).name()), fileName.generic_string());
+    return true;
+}
+
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
 auto MCMCGenerator<M, N, A>::operator()(CLHEP::HepRandomEngine& rng, InitialStateMomenta) -> Event {
     if (not fMCMCInitialized) [[unlikely]] {
         PrintWarning("Markov chain not initialized. Initializing it");
         MCMCInitialize(rng);
     }
+    // Draw from chains in turn
+    fCurrentChain = (fCurrentChain + 1) % fChain.size();
     for (unsigned i{}; i < fThinningSize; ++i) {
         NextEvent(rng);
     }
     NextEvent(rng);
-    return fMC.event;
+    return MC().event;
 }
 
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
@@ -22,6 +22,8 @@
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Math/Estimate.h++"
 #include "Mustard/Math/MCIntegrationUtility.h++"
+#include "Mustard/Math/ScrambledSobol.h++"
+#include "Mustard/Math/VEGASGrid.h++"
 #include "Mustard/Math/Vector.h++"
 #include "Mustard/Parallel/ReseedRandomEngine.h++"
 #include "Mustard/Physics/Generator/EventGenerator.h++"
@@ -36,6 +38,7 @@
 #include "mplr/mplr.hpp"
 
 #include "muc/array"
+#include "muc/ceta_string"
 #include "muc/chrono"
 #include "muc/hash_map"
 #include "muc/hash_set"
@@ -45,20 +48,28 @@
 
 #include "gsl/gsl"
 
+#include "fmt/ranges.h"
 #include "fmt/std.h"
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <map>
 #include <numbers>
+#include <numeric>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 namespace Mustard::inline Physics::inline Generator {
 
@@ -106,6 +117,21 @@ public:
 
     /// @brief Compute 1/S × |M|² × acceptance integral on phase space by Monte Carlo integration.
     /// Useful for calculating total decay width or cross section
+    /// @tparam AMethod "Plain" for plain Monte Carlo on GENBOD's random state,
+    /// "VEGAS" for adaptive importance sampling of GENBOD's random state with a
+    /// `VEGASGrid`, which is much more efficient for peaked integrands, or "QMC"
+    /// for randomized quasi-Monte Carlo with `ScrambledSobol` points, which
+    /// converges faster for smooth integrands. The VEGAS grid is trained (on
+    /// samples not counted in the result) and then refined after each batch,
+    /// with grid statistics summed over all processes. QMC estimates the error
+    /// from independent randomizations of the Sobol sequence.
+    /// @note Samples of "Plain" and "VEGAS" are unbiased estimates of the same
+    /// integral, so the integration state can be continued by either method. The
+    /// VEGAS grid is not a part of the integration state, it is retrained on
+    /// continuation. For "QMC" the integration state holds sums over
+    /// randomizations and cannot be continued.
+    /// @warning Sums, the VEGAS grid and the random engine are shared by all
+    /// samples, so the executor must run a single thread per process.
     /// @param executor An executor instance
     /// @param precisionGoal Target relative uncertainty (e.g. 0.01 for 1% rel. unc.)
     /// @param integrationState Integration state for continuing integration
@@ -113,6 +139,8 @@ public:
     /// @return (1) Monte Carlo integration result of 1/S × |M|² × acceptance integral on phase space
     ///         (2) Effective sample size
     ///         (3) Current integration state
+    template<muc::ceta_string AMethod = "Plain">
+        requires(AMethod == "Plain" or AMethod == "VEGAS" or AMethod == "QMC")
     auto PhaseSpaceIntegral(Executor<unsigned long long>& executor, double precisionGoal,
                             MCIntegrationState integrationState = {},
                             CLHEP::HepRandomEngine& rng = *CLHEP::HepRandom::getTheEngine()) -> std::tuple<Estimate, double, MCIntegrationState>;
@@ -155,6 +183,10 @@ protected:
     /// @param rng Reference to CLHEP random engine
     /// @return An event from phase space
     auto PhaseSpace(CLHEP::HepRandomEngine& rng) -> auto { return fGENBOD(rng, fMomenta); }
+    /// @brief Generate an event on phase space from random state
+    /// @param u Flat random numbers in 0--1
+    /// @return An event from phase space
+    auto PhaseSpace(const typename GENBOD<M, N>::RandomState& u) -> auto { return fGENBOD(u, fMomenta); }
 
     /// @brief Add an identical particle index set
     /// @param set A vector of particle indices (0 ≤ index < N)
@@ -198,11 +230,35 @@ protected:
     /// @return 1/S × |M|²(p1, ..., pN) × acceptance(p1, ..., pN) × |J|(p1, ..., pN), where S is
     /// the final state symmetry factor, and J is the Jacobian of the phase space transformation (e.g. from GENBOD)
     auto MSqAcceptanceDetJ(const FinalStateMomenta& pF, double acceptance, double detJ) const -> double;
+    /// @brief Get weighted PDF values for a batch of phase space points, with range check.
+    /// |M|² is evaluated by `A::Batch`, see the single-point overload for details
+    /// @param pF Final states' 4-momenta of each point
+    /// @param acceptance Acceptance value at each point
+    /// @param detJ |J| at each point
+    /// @param result Output 1/S × |M|² × acceptance × |J| at each point (same size as pF)
+    /// @exception `std::runtime_error` if invalid PDF value produced
+    auto MSqAcceptanceDetJ(std::span<const FinalStateMomenta> pF, std::span<const double> acceptance,
+                           std::span<const double> detJ, std::span<double> result) const -> void;
+
+    /// @brief Get a string identifying the phase space configuration: initial-state momenta,
+    /// polarization (if any), final-state masses, IR cutoffs, identical particle sets and
+    /// runtime options of the matrix element (see `QFT::MatrixElement::Signature`).
+    /// Floating-point values are written exactly, so two configurations match only if
+    /// their signatures are equal
+    /// @note The user-defined acceptance function is not (and cannot be) part of the signature
+    auto ConfigurationSignature() const -> std::string;
 
 private:
+    /// @brief Weighted PDF value from given |M|², with range check
+    auto CheckedMSqAcceptanceDetJ(const FinalStateMomenta& pF, double mSq, double acceptance, double detJ) const -> double;
+
     /// @brief Monte Carlo integration implementation
+    template<muc::ceta_string AMethod>
     auto Integrate(std::regular_invocable<const Event&> auto&& Integrand, double precisionGoal,
                    MCIntegrationState& state, Executor<unsigned long long>& executor, CLHEP::HepRandomEngine& rng) -> std::pair<Estimate, double>;
+    /// @brief Randomized quasi-Monte Carlo integration implementation
+    auto QuasiIntegrate(std::regular_invocable<const Event&> auto&& Integrand, double precisionGoal,
+                        MCIntegrationState& state, Executor<unsigned long long>& executor, CLHEP::HepRandomEngine& rng) -> std::pair<Estimate, double>;
 
 protected:
     [[no_unique_address]] A fMatrixElement; ///< Matrix element
@@ -45,9 +45,13 @@ MatrixElementBasedGenerator<M, N, A>::MatrixElementBasedGenerator(const InitialS
 }
 
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+template<muc::ceta_string AMethod>
+    requires(AMethod == "Plain" or AMethod == "VEGAS" or AMethod == "QMC")
 auto MatrixElementBasedGenerator<M, N, A>::PhaseSpaceIntegral(Executor<unsigned long long>& executor, double precisionGoal,
                                                               MCIntegrationState integrationState,
                                                               CLHEP::HepRandomEngine& rng) -> std::tuple<Estimate, double, MCIntegrationState> {
+    Expects(executor.NThread() == 1);
+
     MasterPrintLn("Integrating |M|^2 * (Acceptance) over phase space in {}.\n", muc::try_demangle(typeid(*this).name()));
     if (fInfraredUnsafePID.empty()) {
         MasterPrintLn("No infrared cutoff is set.\n");
@@ -84,7 +88,13 @@ auto MatrixElementBasedGenerator<M, N, A>::PhaseSpaceIntegral(Executor<unsigned
         return MSqAcceptanceDetJ(pF, acceptance, detJ);
     }};
     muc::chrono::stopwatch stopwatch;
-    const auto [integral, nEff]{Integrate(Integrand, precisionGoal, integrationState, executor, rng)};
+    const auto [integral, nEff]{[&] {
+        if constexpr (AMethod == "QMC") {
+            return QuasiIntegrate(Integrand, precisionGoal, integrationState, executor, rng);
+        } else {
+            return Integrate<AMethod>(Integrand, precisionGoal, integrationState, executor, rng);
+        }
+    }()};
     auto time{muc::chrono::seconds<double>{stopwatch.read()}.count()};
     if (mplr::available()) {
         mplr::comm_world().ireduce(mplr::max<double>{}, 0, time).wait(mplr::duty_ratio::preset::relaxed);
@@ -93,11 +103,12 @@ auto MatrixElementBasedGenerator<M, N, A>::PhaseSpaceIntegral(Executor<unsigned
     // Report result
     const auto& [sumF, sumF2, nSample]{integrationState};
     MasterPrint("Integration completed in {:.3f}s.\n"
-                "Integration state (integration can be continued from here):\n"
+                "Integration state ({}):\n"
                 "  {} {} {}\n"
                 "The integral of |M|^2 * (Acceptance) over phase space:\n"
                 "  {} +/- {}  (rel. unc.: {:.3}%, N_eff: {:.2f})\n",
-                time, sumF, sumF2, nSample, integral.value, integral.uncertainty,
+                time, AMethod == "QMC" ? "sums over randomizations" : "integration can be continued from here",
+                sumF, sumF2, nSample, integral.value, integral.uncertainty,
                 integral.uncertainty / std::abs(integral.value) * 100, nEff);
     return {integral, nEff, integrationState};
 }
@@ -273,7 +284,27 @@ auto MatrixElementBasedGenerator<M, N, A>::MSqAcceptanceDetJ(const FinalStateMom
     if (acceptance <= std::numeric_limits<double>::epsilon()) {
         return 0;
     }
-    const auto mSq{fMatrixElement(fMomenta, pF)};
+    return CheckedMSqAcceptanceDetJ(pF, fMatrixElement(fMomenta, pF), acceptance, detJ);
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MatrixElementBasedGenerator<M, N, A>::MSqAcceptanceDetJ(std::span<const FinalStateMomenta> pF, std::span<const double> acceptance,
+                                                             std::span<const double> detJ, std::span<double> result) const -> void {
+    Expects(acceptance.size() == pF.size());
+    Expects(detJ.size() == pF.size());
+    Expects(result.size() == pF.size());
+    fMatrixElement.Batch(fMomenta, pF, result);
+    for (std::size_t i{}; i < pF.size(); ++i) {
+        Expects(acceptance[i] >= 0);
+        Expects(detJ[i] > 0);
+        result[i] = acceptance[i] <= std::numeric_limits<double>::epsilon() ?
+                        0 :
+                        CheckedMSqAcceptanceDetJ(pF[i], result[i], acceptance[i], detJ[i]);
+    }
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MatrixElementBasedGenerator<M, N, A>::CheckedMSqAcceptanceDetJ(const FinalStateMomenta& pF, double mSq, double acceptance, double detJ) const -> double {
     const auto result{fFSSymmetryFactor * mSq * acceptance * detJ}; // 1/S × |M|² × acceptance × |J|
     constexpr auto Format{[](const FinalStateMomenta& pF, double acceptance, double detJ) {
         auto where{fmt::format("({})", detJ)};
@@ -301,14 +332,70 @@ auto MatrixElementBasedGenerator<M, N, A>::MSqAcceptanceDetJ(const FinalStateMom
 }
 
 template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MatrixElementBasedGenerator<M, N, A>::ConfigurationSignature() const -> std::string {
+    std::string signature;
+    const auto Append{[&](auto... x) { ((fmt::format_to(std::back_inserter(signature), "{:a},", x)), ...); }};
+    if constexpr (M == 1) {
+        Append(fMomenta.e(), fMomenta.x(), fMomenta.y(), fMomenta.z());
+    } else {
+        for (auto&& p : fMomenta) {
+            Append(p.e(), p.x(), p.y(), p.z());
+        }
+    }
+    signature += ';';
+    if constexpr (std::derived_from<A, QFT::PolarizedMatrixElement<M, N>>) {
+        if constexpr (M == 1) {
+            const auto& pol{Polarization()};
+            Append(pol.x(), pol.y(), pol.z());
+        } else {
+            for (auto&& pol : Polarization()) {
+                Append(pol.x(), pol.y(), pol.z());
+            }
+        }
+        signature += ';';
+    }
+    for (auto&& m : fGENBOD.Mass()) {
+        Append(m);
+    }
+    signature += ';';
+    // hash maps are unordered, sort them first
+    for (auto&& [i, cutoff] : std::map{fSoftCutoff.cbegin(), fSoftCutoff.cend()}) {
+        fmt::format_to(std::back_inserter(signature), "{}:", i);
+        Append(cutoff);
+    }
+    signature += ';';
+    for (auto&& [pID, cutoff] : std::map{fCollinearCutoff.cbegin(), fCollinearCutoff.cend()}) {
+        fmt::format_to(std::back_inserter(signature), "{}-{}:", pID.first, pID.second);
+        Append(cutoff);
+    }
+    signature += ';';
+    for (auto&& set : fIdenticalSet) {
+        fmt::format_to(std::back_inserter(signature), "{},", fmt::join(set, "-"));
+    }
+    signature += ';';
+    signature += fMatrixElement.Signature();
+    return signature;
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+template<muc::ceta_string AMethod>
 auto MatrixElementBasedGenerator<M, N, A>::Integrate(std::regular_invocable<const Event&> auto&& Integrand, double precisionGoal,
                                                      MCIntegrationState& state, Executor<unsigned long long>& executor, CLHEP::HepRandomEngine& rng) -> std::pair<Estimate, double> {
     if (precisionGoal <= 0) [[unlikely]] {
         Mustard::PrintWarning(fmt::format("Non-positive precision goal (got {}), taking its absolute value", precisionGoal));
         precisionGoal = std::abs(precisionGoal);
     }
+    // Adaptive grid on GENBOD's random state (VEGAS only)
+    [[maybe_unused]] VEGASGrid<3 * N - 4> grid;
+    const auto RefineGrid{[&] {
+        if (mplr::available()) {
+            const auto accumulator{grid.Accumulator()};
+            mplr::comm_world().allreduce(std::plus<double>{}, accumulator.data(), mplr::contiguous_layout<double>{accumulator.size()});
+        }
+        grid.Refine();
+    }};
     // Core integration method
-    const auto Integrate{[&](unsigned long long nSample) {
+    const auto Sample{[&](unsigned long long nSample) {
         using namespace Mustard::VectorArithmeticOperator::Vector2ArithmeticOperator;
         muc::array2d sum{};
         muc::array2d compensation{};
@@ -319,16 +406,36 @@ auto MatrixElementBasedGenerator<M, N, A>::Integrate(std::regular_invocable<cons
             sum = newSum;
         }};
         executor(nSample, [&](auto) {
-            const auto event{PhaseSpace(rng)};
-            if (not InfraredSafe(event.p)) {
-                return;
+            if constexpr (AMethod == "VEGAS") {
+                typename GENBOD<M, N>::RandomState y;
+                rng.flatArray(y.size(), y.data());
+                const auto [u, jacobian, bin]{grid.Map(y)};
+                const auto event{PhaseSpace(u)};
+                if (not InfraredSafe(event.p)) {
+                    return;
+                }
+                const auto value{jacobian * Integrand(event)};
+                grid.Accumulate(bin, muc::pow(value, 2));
+                KahanAdd({value, muc::pow(value, 2)});
+            } else {
+                const auto event{PhaseSpace(rng)};
+                if (not InfraredSafe(event.p)) {
+                    return;
+                }
+                const auto value{Integrand(event)};
+                KahanAdd({value, muc::pow(value, 2)});
             }
-            const auto value{Integrand(event)};
-            KahanAdd({value, muc::pow(value, 2)});
         });
         if (mplr::available()) {
             mplr::comm_world().allreduce([](auto a, auto b) { return a + b; }, sum);
         }
+        return sum;
+    }};
+    const auto Integrate{[&](unsigned long long nSample) {
+        const auto sum{Sample(nSample)};
+        if constexpr (AMethod == "VEGAS") {
+            RefineGrid();
+        }
         state.sumF += sum[0];
         state.sumF2 += sum[1];
         state.n += nSample;
@@ -339,9 +446,19 @@ auto MatrixElementBasedGenerator<M, N, A>::Integrate(std::regular_invocable<cons
         return std::pair{integral, nEff};
     }};
     // Integration loop
-    MasterPrintLn("Integration starts. Precision goal: {:.3}.", precisionGoal);
+    MasterPrintLn("Integration starts. Method: {}. Precision goal: {:.3}.", AMethod.sv(), precisionGoal);
     const auto initialBatchSize{muc::to_unsigned(muc::llround(muc::pow(precisionGoal, -2)))};
     auto batchSize{std::max(1000000ull * executor.NProcess(), initialBatchSize)};
+    if constexpr (AMethod == "VEGAS") {
+        // Train the grid, samples are not counted in the result
+        constexpr auto nTraining{10};
+        const auto trainingBatchSize{std::max(100000ull * executor.NProcess(), batchSize / nTraining)};
+        MasterPrintLn("Training VEGAS grid with {} x {} samples.", nTraining, trainingBatchSize);
+        for (int i{}; i < nTraining; ++i) {
+            Sample(trainingBatchSize);
+            RefineGrid();
+        }
+    }
     for (int checkpoint{};; ++checkpoint) {
         if (state.n == 0) {
             MasterPrintLn("[Checkpoint {}] Restarting integration.", checkpoint);
@@ -382,4 +499,97 @@ auto MatrixElementBasedGenerator<M, N, A>::Integrate(std::regular_invocable<cons
     }
 }
 
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto MatrixElementBasedGenerator<M, N, A>::QuasiIntegrate(std::regular_invocable<const Event&> auto&& Integrand, double precisionGoal,
+                                                          MCIntegrationState& state, Executor<unsigned long long>& executor, CLHEP::HepRandomEngine& rng) -> std::pair<Estimate, double> {
+    if (precisionGoal <= 0) [[unlikely]] {
+        Mustard::PrintWarning(fmt::format("Non-positive precision goal (got {}), taking its absolute value", precisionGoal));
+        precisionGoal = std::abs(precisionGoal);
+    }
+    if (state.n != 0) [[unlikely]] {
+        Mustard::PrintWarning("Quasi-Monte Carlo integration cannot be continued, restarting integration");
+        state = {};
+    }
+    // Independent randomizations of the Sobol sequence, identical on all processes
+    constexpr auto nRandomization{16};
+    std::vector<ScrambledSobol<3 * N - 4>> sobol;
+    sobol.reserve(nRandomization);
+    for (int r{}; r < nRandomization; ++r) {
+        sobol.emplace_back(rng);
+    }
+    if (mplr::available()) {
+        mplr::comm_world().bcast(0, reinterpret_cast<char*>(sobol.data()),
+                                 mplr::vector_layout<char>{sobol.size() * sizeof(ScrambledSobol<3 * N - 4>)});
+    }
+    // Sums of integrand in each randomization, and of squared integrand over all points
+    std::array<double, nRandomization> sumF{};
+    auto sumF2{0.};
+    // Extend all randomizations from nPoint to nNewPoint points
+    const auto Extend{[&](unsigned long long nPoint, unsigned long long nNewPoint) {
+        std::array<double, nRandomization + 1> sum{};
+        executor({0, (nNewPoint - nPoint) * nRandomization}, [&](auto i) {
+            const auto r{i % nRandomization};
+            const auto event{PhaseSpace(sobol[r](nPoint + i / nRandomization))};
+            if (not InfraredSafe(event.p)) {
+                return;
+            }
+            const auto value{Integrand(event)};
+            sum[r] += value;
+            sum.back() += muc::pow(value, 2);
+        });
+        if (mplr::available()) {
+            mplr::comm_world().allreduce(std::plus<double>{}, sum.data(), mplr::contiguous_layout<double>{sum.size()});
+        }
+        for (int r{}; r < nRandomization; ++r) {
+            sumF[r] += sum[r];
+        }
+        sumF2 += sum.back();
+        // Each randomization gives an independent estimate
+        state = {};
+        for (auto&& f : sumF) {
+            const auto estimate{f / nNewPoint};
+            state.sumF += estimate;
+            state.sumF2 += muc::pow(estimate, 2);
+            ++state.n;
+        }
+        Estimate integral;
+        integral.value = state.sumF / state.n;
+        integral.uncertainty = std::sqrt(std::max(0., state.sumF2 / state.n - muc::pow(integral.value, 2)) / (state.n - 1));
+        const auto sumAllF{std::accumulate(sumF.cbegin(), sumF.cend(), 0.)};
+        const auto nEff{muc::pow(sumAllF, 2) / sumF2};
+        return std::pair{integral, nEff};
+    }};
+    // Integration loop, the number of points per randomization is kept a power of 2
+    MasterPrintLn("Integration starts. Method: QMC ({} randomizations). Precision goal: {:.3}.", nRandomization, precisionGoal);
+    constexpr auto maxNPoint{1ull << 32};
+    auto nPoint{0ull};
+    auto nNewPoint{std::bit_ceil(std::max(1000000ull * executor.NProcess(), muc::to_unsigned(muc::llround(1 / precisionGoal))) / nRandomization)};
+    for (int checkpoint{};; ++checkpoint) {
+        MasterPrintLn("[Checkpoint {}] Integrate with {} x {} points. Precision goal: {:.3}.", checkpoint, nRandomization, nNewPoint, precisionGoal);
+        const auto [integral, nEff]{Extend(nPoint, nNewPoint)};
+        const auto precision{integral.uncertainty / std::abs(integral.value)};
+        if (precision <= precisionGoal or nNewPoint == maxNPoint) {
+            if (precision > precisionGoal) {
+                Mustard::PrintWarning(fmt::format("Sobol sequence exhausted (2^32 points), precision goal {:.3} not reached", precisionGoal));
+            }
+            MasterPrint("Current precision: {:.3}, N_eff: {:.2f}.\n"
+                        "\n"
+                        "Integration completed with {} x {} points.\n",
+                        precision, nEff, nRandomization, nNewPoint);
+            return {integral, nEff};
+        }
+        MasterPrint("Current precision: {:.3}, N_eff: {:.2f}, precision goal {:.3} not reached.\n"
+                    "\n",
+                    precision, nEff, precisionGoal);
+        // Estimate throughput, just a very approximate value
+        const auto nPointPerMin{nRandomization * (nNewPoint - nPoint) / muc::chrono::minutes<double>{executor.ExecutionInfo().wallTime}.count()};
+        // Error decreases about as 1/N for smooth integrands, or as 1/sqrt(N) at worst
+        const auto factor{std::isfinite(precision) ? precision / precisionGoal : 16.};
+        const auto nPointUpperBound{std::max(2 * nNewPoint, muc::to_unsigned(std::llround(15 * nPointPerMin / nRandomization)))};
+        nPoint = nNewPoint;
+        nNewPoint = std::min({std::bit_ceil(std::max(2 * nNewPoint, static_cast<unsigned long long>(factor * nNewPoint))),
+                              std::bit_floor(nPointUpperBound), maxNPoint});
+    }
+}
+
 } // namespace Mustard::inline Physics::inline Generator
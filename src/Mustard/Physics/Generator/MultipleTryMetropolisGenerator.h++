@@ -32,9 +32,12 @@
 #include <array>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <limits>
 #include <optional>
+#include <span>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
 
 namespace Mustard::inline Physics::inline Generator {
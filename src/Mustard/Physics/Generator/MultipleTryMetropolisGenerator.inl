@@ -82,11 +82,14 @@ auto MultipleTryMetropolisGenerator<M, N, A>::NextEvent(CLHEP::HepRandomEngine&
     }
 
     // Multiple-try Metropolis sampler (Jun S. Liu et al (2000), https://doi.org/10.2307/2669532)
-    std::array<struct MarkovChain::State, fgNTrial> stateY; // y_1, ..., y_k
-    std::array<struct Base::Event, fgNTrial> eventY;        // Event at y_1, ..., y_k
-    std::array<double, fgNTrial> acceptanceY;               // Acceptance function value at y_1, ..., y_k
-    std::array<double, fgNTrial> piY;                       // pi(y_1), ..., pi(y_k)
-    struct MarkovChain::State stateX;                       // x_i
+    std::array<struct MarkovChain::State, fgNTrial> stateY;    // y_1, ..., y_k
+    std::array<struct Base::Event, fgNTrial> eventY;           // Event at y_1, ..., y_k
+    std::array<double, fgNTrial> acceptanceY;                  // Acceptance function value at y_1, ..., y_k
+    std::array<double, fgNTrial> piY;                          // pi(y_1), ..., pi(y_k)
+    std::array<struct MarkovChain::State, fgNTrial - 1> stateX; // x_1, ..., x_{k-1}
+    std::array<struct Base::Event, fgNTrial - 1> eventX;        // Event at x_1, ..., x_{k-1}
+    std::array<double, fgNTrial - 1> acceptanceX;               // Acceptance function value at x_1, ..., x_{k-1}
+    std::array<double, fgNTrial - 1> piX;                       // pi(x_1), ..., pi(x_{k-1})
     // Symmetric T(x, y)
     const auto ProposeState{[&](const struct MarkovChain::State& state0, struct MarkovChain::State& state) {
         // Walk random state
@@ -100,19 +103,46 @@ auto MultipleTryMetropolisGenerator<M, N, A>::NextEvent(CLHEP::HepRandomEngine&
         // Walk particle mapping if necessary
         this->ProposePID(rng, state0.pID, state.pID);
     }};
+    // Trials are independent, so evaluate pi(s_1), ..., pi(s_n) with |M|² in one batch
+    const auto EvaluatePi{[this](std::span<const struct MarkovChain::State> state, std::span<struct Base::Event> event,
+                                 std::span<double> acceptance, std::span<double> pi) {
+        std::array<typename Base::FinalStateMomenta, fgNTrial> batchP;
+        std::array<double, fgNTrial> batchAcceptance;
+        std::array<double, fgNTrial> batchDetJ;
+        std::array<double, fgNTrial> batchPi;
+        std::array<std::size_t, fgNTrial> batchIndex;
+        std::size_t nBatch{};
+        for (std::size_t i{}; i < state.size(); ++i) {
+            double detJ;
+            std::tie(event[i], detJ) = this->PhaseSpace(state[i]); // s_i -> event(s_i) = g(s_i), also get |J|(g(s_i))
+            if (not this->InfraredSafe(event[i].p)) {
+                pi[i] = 0;
+                continue;
+            }
+            acceptance[i] = this->Acceptance(event[i].p); // g(s_i) -> B(g(s_i))
+            if (acceptance[i] <= std::numeric_limits<double>::epsilon()) {
+                pi[i] = 0; // no need to evaluate |M|²
+                continue;
+            }
+            batchP[nBatch] = event[i].p;
+            batchAcceptance[nBatch] = acceptance[i];
+            batchDetJ[nBatch] = detJ;
+            batchIndex[nBatch] = i;
+            ++nBatch;
+        }
+        // g(s_i) -> pi(s_i) = |M|²(g(s_i)) × B(g(s_i)) × |J|(g(s_i))
+        this->MSqAcceptanceDetJ(std::span{batchP}.first(nBatch), std::span{batchAcceptance}.first(nBatch),
+                                std::span{batchDetJ}.first(nBatch), std::span{batchPi}.first(nBatch));
+        for (std::size_t j{}; j < nBatch; ++j) {
+            pi[batchIndex[j]] = batchPi[j];
+        }
+    }};
 
     // y_1, ..., y_k
-    for (int i{}; i < fgNTrial; ++i) {
-        ProposeState(this->fMC.state, stateY[i]); // Draw y_i from T(x, *)
-        double detJ;
-        std::tie(eventY[i], detJ) = this->PhaseSpace(stateY[i]); // y_i -> event(y_i) = g(y_i), also get |J|(g(y_i))
-        if (not this->InfraredSafe(eventY[i].p)) {
-            piY[i] = 0;
-            continue;
-        }
-        acceptanceY[i] = this->Acceptance(eventY[i].p);                      // g(y_i) -> B(g(y_i))
-        piY[i] = this->MSqAcceptanceDetJ(eventY[i].p, acceptanceY[i], detJ); // g(y_i) -> pi(y_i) = |M|²(g(y_i)) × B(g(y_i)) × |J|(g(y_i))
+    for (auto&& y : stateY) {
+        ProposeState(this->MC().state, y); // Draw y_i from T(x, *)
     }
+    EvaluatePi(stateY, eventY, acceptanceY, piY);
     const auto sumPiY{muc::ranges::reduce(piY)}; // pi(y_1) + ... + pi(y_k)
     const auto selected{[&] {                    // Select Y from y_1, ..., y_k by pi(y_1), ..., pi(y_k)
         const auto u{sumPiY * rng.flat()};
@@ -127,24 +157,19 @@ auto MultipleTryMetropolisGenerator<M, N, A>::NextEvent(CLHEP::HepRandomEngine&
     }()};
 
     // x_1, ..., x_k (note that x_k = x)
-    auto sumPiX{this->fMC.mSqAcceptanceDetJ}; // pi(x_1) + ... + pi(x_k)
-    for (int i{}; i < fgNTrial - 1; ++i) {
-        ProposeState(stateY[selected], stateX);             // Draw x_i from T(Y, *)
-        const auto [event, detJ]{this->PhaseSpace(stateX)}; // x_i -> event(x_i) = g(x_i), also get |J|(g(x_i))
-        if (not this->InfraredSafe(event.p)) {
-            continue;
-        }
-        const auto acceptanceX{this->Acceptance(event.p)};             // g(x_i) -> B(g(x_i))
-        sumPiX += this->MSqAcceptanceDetJ(event.p, acceptanceX, detJ); // g(x_i) -> pi(x_i) = |M|²(g(x_i)) × B(g(x_i)) × |J|(g(y_i))
+    for (auto&& x : stateX) {
+        ProposeState(stateY[selected], x); // Draw x_i from T(Y, *)
     }
+    EvaluatePi(stateX, eventX, acceptanceX, piX);
+    const auto sumPiX{this->MC().mSqAcceptanceDetJ + muc::ranges::reduce(piX)}; // pi(x_1) + ... + pi(x_k)
 
     // accept/reject Y
     if (sumPiY >= sumPiX or
         sumPiY > sumPiX * rng.flat()) {
-        this->fMC.state = stateY[selected];
-        this->fMC.mSqAcceptanceDetJ = piY[selected];
-        this->fMC.event = std::move(eventY[selected]);
-        this->fMC.event.weight = 1 / acceptanceY[selected];
+        this->MC().state = stateY[selected];
+        this->MC().mSqAcceptanceDetJ = piY[selected];
+        this->MC().event = std::move(eventY[selected]);
+        this->MC().event.weight = 1 / acceptanceY[selected];
         return true;
     }
     return false;
@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Math/VEGASGrid.h++"
+#include "Mustard/Math/Vector.h++"
+#include "Mustard/Physics/Generator/GENBOD.h++"
+#include "Mustard/Physics/Generator/MatrixElementBasedGenerator.h++"
+#include "Mustard/Physics/QFT/MatrixElement.h++"
+#include "Mustard/Physics/QFT/PolarizedMatrixElement.h++"
+
+#include "CLHEP/Random/Random.h"
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/math"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace Mustard::inline Physics::inline Generator {
+
+/// @class WeightedEventGenerator
+/// @brief Weighted event generator sampling phase space directly,
+/// possibly with user-defined acceptance.
+///
+/// Samples GENBOD's random state uniformly, or through a trained VEGAS grid
+/// (see `TrainVEGAS`), and returns events with
+/// weight = 1/S × |M|² × |J| (× VEGAS Jacobian). Every |M|² evaluation yields
+/// an event, no Markov chain initialization nor thinning is involved.
+/// Phase space points failing IR cutoffs, or with zero acceptance, are skipped.
+/// The sum of weights divided by `NTrial()` estimates the phase space integral
+/// of 1/S × |M|² (over the region of non-zero acceptance).
+///
+/// Optionally, events are partially unweighted on the fly (see
+/// `UnweightingThreshold`): an event of weight w below r × w_max is kept
+/// with probability w / (r × w_max) and given weight r × w_max, where w_max is
+/// a running maximum. The acceptance enters the unweighting as in the MCMC
+/// generators, i.e. events are unweighted against |M|² × acceptance and then
+/// carry an extra weight of 1 / acceptance.
+///
+/// @tparam M Number of initial-state particles
+/// @tparam N Number of final-state particles
+/// @tparam A Matrix element of the process to be generated
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+class WeightedEventGenerator : public MatrixElementBasedGenerator<M, N, A> {
+private:
+    /// @brief The base class
+    using Base = MatrixElementBasedGenerator<M, N, A>;
+
+public:
+    /// @brief Initial-state 4-momentum (or container type when M>1)
+    using typename Base::InitialStateMomenta;
+    /// @brief Final-state 4-momentum container type
+    using typename Base::FinalStateMomenta;
+    /// @brief Generated event type
+    using typename Base::Event;
+
+public:
+    /// @brief Construct event generator
+    /// @param pI initial-state 4-momenta
+    /// @param pdgID Array of particle PDG IDs (index order preserved)
+    /// @param mass Array of particle masses (index order preserved)
+    /// @param unweightingThreshold Partial unweighting threshold (optional, no unweighting if not set)
+    WeightedEventGenerator(const InitialStateMomenta& pI, const std::array<int, N>& pdgID, const std::array<double, N>& mass,
+                           std::optional<double> unweightingThreshold = {});
+    /// @brief Construct event generator
+    /// @param pI initial-state 4-momenta
+    /// @param polarization Initial-state polarization vector(s)
+    /// @param pdgID Array of particle PDG IDs (index order preserved)
+    /// @param mass Array of particle masses (index order preserved)
+    /// @param unweightingThreshold Partial unweighting threshold (optional, no unweighting if not set)
+    /// @note This overload is only enabled for polarized process
+    WeightedEventGenerator(const InitialStateMomenta& pI, const typename A::InitialStatePolarization& polarization,
+                           const std::array<int, N>& pdgID, const std::array<double, N>& mass,
+                           std::optional<double> unweightingThreshold = {})
+        requires std::derived_from<A, QFT::PolarizedMatrixElement<M, N>>;
+
+    using Base::Momenta;
+    using Base::Polarization;
+    using Base::PDGID;
+    using Base::Mass;
+    using Base::AddIdenticalSet;
+    using Base::SoftCutoff;
+    using Base::CollinearCutoff;
+    using Base::Acceptance;
+
+    /// @brief Set partial unweighting threshold r.
+    /// Events of weight below r × (running max weight) are unweighted
+    /// @param r Threshold (0 ≤ r ≤ 1, 0 for weighted events, 1 for full unweighting)
+    auto UnweightingThreshold(double r) -> void;
+    /// @brief Get running max of |M|² × acceptance weight
+    auto MaxWeight() const -> auto { return fMaxWeight; }
+    /// @brief Get number of phase space points sampled so far (including skipped and rejected ones)
+    auto NTrial() const -> auto { return fNTrial; }
+    /// @brief Reset trial counter and running max weight
+    auto ResetStatistics() -> void;
+
+    /// @brief Train a VEGAS grid on GENBOD's random state, and sample through it afterwards.
+    /// Max weight is estimated by the way
+    /// @param nSample Number of samples per iteration in this process
+    /// @param nIteration Number of training iterations
+    /// @param rng Reference to CLHEP random engine
+    /// @note Grid statistics and max weight are pooled over processes, so this is an MPI collective operation
+    auto TrainVEGAS(unsigned long long nSample, int nIteration = 10,
+                    CLHEP::HepRandomEngine& rng = *CLHEP::HepRandom::getTheEngine()) -> void;
+    /// @brief Drop the VEGAS grid and sample uniformly again
+    auto DropVEGAS() -> void { fGrid.reset(); }
+
+    /// @brief Generate event
+    /// @param rng Reference to CLHEP random engine
+    /// @return Generated event
+    /// @warning Initial-state momenta passed to this function are ignored.
+    /// Use `Momenta` to set initial-state momenta
+    virtual auto operator()(CLHEP::HepRandomEngine& rng, InitialStateMomenta) -> Event override;
+    // Avoid hiding other operator() overloads from base class
+    using Base::operator();
+
+private:
+    /// @brief Sample a phase space point
+    /// @return The event (weight unset), its acceptance, and 1/S × |M|² × acceptance × |J| (× VEGAS Jacobian),
+    /// or nullopt if the point is IR-unsafe
+    auto Sample(CLHEP::HepRandomEngine& rng) -> std::optional<std::tuple<Event, double, double>>;
+
+private:
+    double fUnweightingThreshold;              ///< Partial unweighting threshold
+    double fMaxWeight;                         ///< Running max of |M|² × acceptance weight
+    unsigned long long fNTrial;                ///< Number of phase space points sampled
+    std::optional<VEGASGrid<3 * N - 4>> fGrid; ///< VEGAS grid on GENBOD's random state (if trained)
+};
+
+} // namespace Mustard::inline Physics::inline Generator
+
+#include "Mustard/Physics/Generator/WeightedEventGenerator.inl"
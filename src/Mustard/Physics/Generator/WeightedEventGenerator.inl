@@ -0,0 +1,138 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Physics::inline Generator {
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+WeightedEventGenerator<M, N, A>::WeightedEventGenerator(const InitialStateMomenta& pI, const std::array<int, N>& pdgID, const std::array<double, N>& mass,
+                                                        std::optional<double> unweightingThreshold) :
+    Base{pI, pdgID, mass},
+    fUnweightingThreshold{},
+    fMaxWeight{},
+    fNTrial{},
+    fGrid{} {
+    if (unweightingThreshold) {
+        UnweightingThreshold(*unweightingThreshold);
+    }
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+WeightedEventGenerator<M, N, A>::WeightedEventGenerator(const InitialStateMomenta& pI, const typename A::InitialStatePolarization& polarization,
+                                                        const std::array<int, N>& pdgID, const std::array<double, N>& mass,
+                                                        std::optional<double> unweightingThreshold) // clang-format off
+    requires std::derived_from<A, QFT::PolarizedMatrixElement<M, N>> : // clang-format on
+    WeightedEventGenerator{pI, pdgID, mass, std::move(unweightingThreshold)} {
+    this->Polarization(polarization);
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto WeightedEventGenerator<M, N, A>::UnweightingThreshold(double r) -> void {
+    if (not(0 <= r and r <= 1)) [[unlikely]] {
+        PrintError(fmt::format("Unweighting threshold should be within [0, 1] (got {}), not setting it", r));
+        return;
+    }
+    fUnweightingThreshold = r;
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto WeightedEventGenerator<M, N, A>::ResetStatistics() -> void {
+    fMaxWeight = 0;
+    fNTrial = 0;
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto WeightedEventGenerator<M, N, A>::TrainVEGAS(unsigned long long nSample, int nIteration, CLHEP::HepRandomEngine& rng) -> void {
+    MasterPrintLn("Training VEGAS grid with {} x {} samples.", nIteration, nSample);
+    VEGASGrid<3 * N - 4> grid;
+    double maxWeight{};
+    for (int i{}; i < nIteration; ++i) {
+        maxWeight = 0; // weights of the last iteration are the most representative
+        for (unsigned long long j{}; j < nSample; ++j) {
+            typename GENBOD<M, N>::RandomState y;
+            rng.flatArray(y.size(), y.data());
+            const auto [u, jacobian, bin]{grid.Map(y)};
+            const auto event{this->PhaseSpace(u)};
+            if (not this->InfraredSafe(event.p)) {
+                continue;
+            }
+            const auto detJ{event.weight};
+            const auto weight{jacobian * this->MSqAcceptanceDetJ(event.p, this->Acceptance(event.p), detJ)};
+            grid.Accumulate(bin, muc::pow(weight, 2));
+            maxWeight = std::max(maxWeight, weight);
+        }
+        if (mplr::available()) {
+            const auto accumulator{grid.Accumulator()};
+            mplr::comm_world().allreduce(std::plus<double>{}, accumulator.data(), mplr::contiguous_layout<double>{accumulator.size()});
+        }
+        grid.Refine();
+    }
+    if (mplr::available()) {
+        mplr::comm_world().allreduce(mplr::max<double>{}, maxWeight);
+    }
+    fGrid = grid;
+    fMaxWeight = maxWeight;
+    MasterPrintLn("VEGAS grid trained. Max weight: {:.6}.", fMaxWeight);
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto WeightedEventGenerator<M, N, A>::operator()(CLHEP::HepRandomEngine& rng, InitialStateMomenta) -> Event {
+    while (true) {
+        auto sample{Sample(rng)};
+        if (not sample) {
+            continue;
+        }
+        auto& [event, acceptance, weight]{*sample};
+        if (weight <= 0) {
+            continue;
+        }
+        fMaxWeight = std::max(fMaxWeight, weight);
+        // Partial unweighting
+        const auto threshold{fUnweightingThreshold * fMaxWeight};
+        if (weight < threshold) {
+            if (weight < threshold * rng.flat()) {
+                continue;
+            }
+            weight = threshold;
+        }
+        event.weight = weight / acceptance;
+        return event;
+    }
+}
+
+template<int M, int N, std::derived_from<QFT::MatrixElement<M, N>> A>
+auto WeightedEventGenerator<M, N, A>::Sample(CLHEP::HepRandomEngine& rng) -> std::optional<std::tuple<Event, double, double>> {
+    ++fNTrial;
+    typename GENBOD<M, N>::RandomState u;
+    rng.flatArray(u.size(), u.data());
+    double jacobian{1};
+    if (fGrid) {
+        const auto point{fGrid->Map(u)};
+        u = point.x;
+        jacobian = point.jacobian;
+    }
+    auto event{this->PhaseSpace(u)};
+    if (not this->InfraredSafe(event.p)) {
+        return std::nullopt;
+    }
+    const auto detJ{event.weight};
+    const auto acceptance{this->Acceptance(event.p)};
+    const auto weight{jacobian * this->MSqAcceptanceDetJ(event.p, acceptance, detJ)};
+    return std::tuple{std::move(event), acceptance, weight};
+}
+
+} // namespace Mustard::inline Physics::inline Generator
@@ -18,12 +18,17 @@
 
 #include "Mustard/Math/Vector.h++"
 #include "Mustard/Physics/QFT/MSqM2ENNEE.h++"
+#include "Mustard/Physics/QFT/internal/DoublePack.h++"
 #include "Mustard/Utility/MathConstant.h++"
 #include "Mustard/Utility/PhysicalConstant.h++"
 
 #include "muc/math"
 
+#include "gsl/gsl"
+
+#include <algorithm>
 #include <cmath>
+#include <string>
 
 namespace Mustard::inline Physics::QFT {
 
@@ -45,6 +50,30 @@ auto MSqM2ENNEE::operator()(const InitialStateMomenta& pI, const FinalStateMomen
     }
 }
 
+auto MSqM2ENNEE::Batch(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void {
+    switch (fVersion) {
+    case Ver::McMule0Av:
+        BatchMcMule0Av(pI, pF, mSq);
+        return;
+    case Ver::McMuleLegacy:
+        PolarizedMatrixElement::Batch(pI, pF, mSq);
+        return;
+    default:
+        Throw<std::invalid_argument>("No such version");
+    }
+}
+
+auto MSqM2ENNEE::Signature() const -> std::string {
+    switch (fVersion) {
+    case Ver::McMule0Av:
+        return "McMule0Av";
+    case Ver::McMuleLegacy:
+        return "McMuleLegacy";
+    default:
+        Throw<std::invalid_argument>("No such version");
+    }
+}
+
 auto MSqM2ENNEE::MSqMcMule0Av(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double {
     const auto& p1{pI};
     const auto& [p2, _1, _2, p3, p4]{pF};
@@ -91,8 +120,76 @@ auto MSqM2ENNEE::MSqMcMule0Av(const InitialStateMomenta& pI, const FinalStateMom
     return muc::pow(2 * pi * fine_structure_const * reduced_Fermi_constant, 2) * pm2enneeav;
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBorn(double s12, double s13, double s14, double s23, double s24, double s34,
-                                               double m12, double m22, double) -> double {
+auto MSqM2ENNEE::BatchMcMule0Av(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void {
+    Expects(pF.size() == mSq.size());
+    using Pack = internal::DoublePack<fgBatchWidth>;
+
+    constexpr auto s{[](auto&& a, auto&& b) {
+        return 2 * (a * b);
+    }};
+
+    const auto& p1{pI};
+    const auto m12{p1.m2()};
+
+    const auto polarized{Polarization() != Vector3D{}};
+    const auto sqrtM12{polarized ? std::sqrt(m12) : 0};
+    const VectorLor n{-Polarization()};
+
+    constexpr auto constant{muc::pow(2 * pi * fine_structure_const * reduced_Fermi_constant, 2)};
+
+    for (std::size_t first{}; first < pF.size(); first += fgBatchWidth) {
+        // The last block is padded with its last point
+        const auto point{[&](std::size_t i) -> const FinalStateMomenta& {
+            return pF[std::min(first + i, pF.size() - 1)];
+        }};
+
+        Pack s13, m32, s3n;
+        for (std::size_t i{}; i < fgBatchWidth; ++i) {
+            const auto& p3{point(i)[3]};
+            s13[i] = s(p1, p3);
+            m32[i] = p3.m2();
+            if (polarized) { s3n[i] = s(p3, n); }
+        }
+
+        Pack pm2enneeav{};
+        const auto m2enneeavImpl{[&](int j2, int j4) {
+            Pack s12, s14, s23, s24, s34, m22, s2n, s4n;
+            for (std::size_t i{}; i < fgBatchWidth; ++i) {
+                const auto& p2{point(i)[j2]};
+                const auto& p3{point(i)[3]};
+                const auto& p4{point(i)[j4]};
+                s12[i] = s(p1, p2);
+                s14[i] = s(p1, p4);
+                s23[i] = s(p2, p3);
+                s24[i] = s(p2, p4);
+                s34[i] = s(p3, p4);
+                m22[i] = p2.m2();
+                if (polarized) {
+                    s2n[i] = s(p2, n);
+                    s4n[i] = s(p4, n);
+                }
+            }
+            pm2enneeav += 2 * OneBorn<Pack>(s12, s13, s14, s23, s24, s34, m12, m22, m32) +
+                          TwoBorn<Pack>(s12, s13, s14, s23, s24, s34, m12, m22, m32);
+            if (polarized) {
+                pm2enneeav += sqrtM12 *
+                              (2 * OneBornPol<Pack>(s12, s13, s14, s23, s24, s34, m12, m22, m32, s2n, s3n, s4n) +
+                               TwoBornPol<Pack>(s12, s13, s14, s23, s24, s34, m12, m22, m32, s2n, s3n, s4n));
+            }
+        }};
+        m2enneeavImpl(0, 4);
+        m2enneeavImpl(4, 0);
+
+        const auto nValid{std::min(fgBatchWidth, pF.size() - first)};
+        for (std::size_t i{}; i < nValid; ++i) {
+            mSq[first + i] = constant * pm2enneeav[i];
+        }
+    }
+}
+
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBorn(T s12, T s13, T s14, T s23, T s24, T s34,
+                                               T m12, T m22, T) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudecrare/mudecrare_1l_onetrace.opt.f95, FUNCTION bornPol
@@ -753,9 +850,10 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBorn(double s12, double s13, double s1
             (-s12 + s23 + tmp3 + tmp7) * (-s14 + s34 + tmp3 + tmp7));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBornPol(double s12, double s13, double s14, double s23, double s24, double s34,
-                                                  double m12, double m22, double,
-                                                  double s2n, double s3n, double s4n) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBornPol(T s12, T s13, T s14, T s23, T s24, T s34,
+                                                  T m12, T m22, T,
+                                                  T s2n, T s3n, T s4n) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudecrare/mudecrare_1l_onetrace.opt.f95, FUNCTION bornPol
@@ -1279,8 +1377,9 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::OneBornPol(double s12, double s13, double
             (-s12 + s23 + tmp3 + tmp7) * (-s14 + s34 + tmp3 + tmp7));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::TwoBorn(double s12, double s13, double s14, double s23, double s24, double s34,
-                                               double m12, double m22, double m32) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::TwoBorn(T s12, T s13, T s14, T s23, T s24, T s34,
+                                               T m12, T m22, T m32) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudecrare/mudecrare_1l_twotrace.opt.f95, FUNCTION born
@@ -2303,9 +2402,10 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::TwoBorn(double s12, double s13, double s1
             pow(s23 + s24 + s34 + tmp1, 2));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::TwoBornPol(double s12, double s13, double s14, double s23, double s24, double s34,
-                                                  double m12, double m22, double m32,
-                                                  double s2n, double s3n, double s4n) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNEE::TwoBornPol(T s12, T s13, T s14, T s23, T s24, T s34,
+                                                  T m12, T m22, T m32,
+                                                  T s2n, T s3n, T s4n) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudecrare/mudecrare_1l_twotrace.opt.f95, FUNCTION bornPol
@@ -21,6 +21,10 @@
 #include "Mustard/Physics/QFT/PolarizedMatrixElement.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 
+#include <cstddef>
+#include <span>
+#include <string>
+
 namespace Mustard::inline Physics::QFT {
 
 /// @class MSqM2ENNEE
@@ -56,24 +60,38 @@ public:
     ///
     /// @note Implementation based on McMule's analytical expressions
     virtual auto operator()(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double override;
+    /// @brief Calculate squared matrix element for a batch of phase space points.
+    /// Kernels of `Ver::McMule0Av` are evaluated for several points at once,
+    /// see `MatrixElement::Batch`
+    virtual auto Batch(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void override;
+    /// @brief Get a string identifying the matrix element version
+    virtual auto Signature() const -> std::string override;
 
 private:
     auto MSqMcMule0Av(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double;
-    MUSTARD_OPTIMIZE_FAST static auto OneBorn(double s12, double s13, double s14, double s23, double s24, double s34,
-                                              double m12, double m22, double) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto OneBornPol(double s12, double s13, double s14, double s23, double s24, double s34,
-                                                 double m12, double m22, double,
-                                                 double s2n, double s3n, double s4n) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto TwoBorn(double s12, double s13, double s14, double s23, double s24, double s34,
-                                              double m12, double m22, double m32) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto TwoBornPol(double s12, double s13, double s14, double s23, double s24, double s34,
-                                                 double m12, double m22, double m32,
-                                                 double s2n, double s3n, double s4n) -> double;
+    auto BatchMcMule0Av(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto OneBorn(T s12, T s13, T s14, T s23, T s24, T s34,
+                                              T m12, T m22, T) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto OneBornPol(T s12, T s13, T s14, T s23, T s24, T s34,
+                                                 T m12, T m22, T,
+                                                 T s2n, T s3n, T s4n) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto TwoBorn(T s12, T s13, T s14, T s23, T s24, T s34,
+                                              T m12, T m22, T m32) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto TwoBornPol(T s12, T s13, T s14, T s23, T s24, T s34,
+                                                 T m12, T m22, T m32,
+                                                 T s2n, T s3n, T s4n) -> T;
 
     MUSTARD_OPTIMIZE_FAST auto MSqMcMuleLegacy(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double;
 
 private:
     Ver fVersion;
+
+    /// @brief Number of phase space points evaluated at once by `Batch`
+    static constexpr std::size_t fgBatchWidth{4};
 };
 
 } // namespace Mustard::inline Physics::QFT
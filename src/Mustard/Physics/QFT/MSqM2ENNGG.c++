@@ -18,11 +18,15 @@
 
 #include "Mustard/Math/Vector.h++"
 #include "Mustard/Physics/QFT/MSqM2ENNGG.h++"
+#include "Mustard/Physics/QFT/internal/DoublePack.h++"
 #include "Mustard/Utility/MathConstant.h++"
 #include "Mustard/Utility/PhysicalConstant.h++"
 
 #include "muc/math"
 
+#include "gsl/gsl"
+
+#include <algorithm>
 #include <cmath>
 
 namespace Mustard::inline Physics::QFT {
@@ -77,8 +81,69 @@ auto MSqM2ENNGG::operator()(const InitialStateMomenta& pI, const FinalStateMomen
     return constant * pm2ennggav;
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::Unpolarized(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                   double den1, double den2, double den3, double den4, double den5, double den6) -> double {
+auto MSqM2ENNGG::Batch(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void {
+    Expects(pF.size() == mSq.size());
+    using Pack = internal::DoublePack<fgBatchWidth>;
+
+    constexpr auto s{[](auto&& a, auto&& b) {
+        return 2 * (a * b);
+    }};
+
+    const auto& p1{pI};
+    const auto mm2{p1.m2()};
+    const auto polarized{Polarization() != Vector3D{}};
+    const VectorLor pol1{Polarization()};
+    constexpr auto constant{4 * muc::pow(reduced_Fermi_constant, 2) * muc::pow(4 * pi * fine_structure_const, 2)};
+
+    for (std::size_t first{}; first < pF.size(); first += fgBatchWidth) {
+        // invariants of fgBatchWidth points, lane by lane (the last block is padded with its last point)
+        Pack me2, s12, s15, s16, s25, s26, s56, s2n, s5n, s6n;
+        for (std::size_t i{}; i < fgBatchWidth; ++i) {
+            const auto& [p2, _1, _2, p5, p6]{pF[std::min(first + i, pF.size() - 1)]};
+            me2[i] = p2.m2();
+            s12[i] = s(p1, p2);
+            s15[i] = s(p1, p5);
+            s16[i] = s(p1, p6);
+            s25[i] = s(p2, p5);
+            s26[i] = s(p2, p6);
+            s56[i] = s(p5, p6);
+            if (polarized) {
+                s2n[i] = s(pol1, p2);
+                s5n[i] = s(pol1, p5);
+                s6n[i] = s(pol1, p6);
+            }
+        }
+
+        const auto den1{s25 * (s25 + s26 + s56)};
+        const auto den2{s26 * (s25 + s26 + s56)};
+        const auto den3{-(s15 * (s15 + s16 - s56))};
+        const auto den4{s15 * s26};
+        const auto den5{-(s16 * (s15 + s16 - s56))};
+        const auto den6{s16 * s25};
+
+        auto pm2ennggav{Unpolarized<Pack>(mm2, me2, s12, s15, s16, s25, s26, s56,
+                                          den1, den2, den3, den4, den5, den6)};
+        if (polarized) {
+            pm2ennggav += s2n * PolarizedS2n<Pack>(mm2, me2, s12, s15, s16, s25, s26, s56,
+                                                   den1, den2, den3, den4, den5, den6);
+            pm2ennggav += s5n * PolarizedS5n<Pack>(mm2, me2, s12, s15, s16, s25, s26, s56,
+                                                   den1, den2, den3, den4, den5, den6);
+            pm2ennggav += s6n * PolarizedS6n<Pack>(mm2, me2, s12, s15, s16, s25, s26, s56,
+                                                   den1, den2, den3, den4, den5, den6);
+            pm2ennggav *= std::sqrt(mm2);
+        }
+        pm2ennggav *= -4 / 3.;
+
+        const auto nValid{std::min(fgBatchWidth, pF.size() - first)};
+        for (std::size_t i{}; i < nValid; ++i) {
+            mSq[first + i] = constant * pm2ennggav[i];
+        }
+    }
+}
+
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::Unpolarized(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                   T den1, T den2, T den3, T den4, T den5, T den6) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudec/mudec_pm2ennggav.f95
@@ -1469,8 +1534,9 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::Unpolarized(double mm2, double me2, doubl
                 if56 / (den5 * den6));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS2n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                    double den1, double den2, double den3, double den4, double den5, double den6) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS2n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                    T den1, T den2, T den3, T den4, T den5, T den6) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudec/mudec_pm2ennggav.f95
@@ -1910,8 +1976,9 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS2n(double mm2, double me2, doub
                 if56 / (den5 * den6));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS5n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                    double den1, double den2, double den3, double den4, double den5, double den6) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS5n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                    T den1, T den2, T den3, T den4, T den5, T den6) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudec/mudec_pm2ennggav.f95
@@ -2330,8 +2397,9 @@ MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS5n(double mm2, double me2, doub
                 if56 / (den5 * den6));
 }
 
-MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS6n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                    double den1, double den2, double den3, double den4, double den5, double den6) -> double {
+template<typename T>
+MUSTARD_OPTIMIZE_FAST auto MSqM2ENNGG::PolarizedS6n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                    T den1, T den2, T den3, T den4, T den5, T den6) -> T {
     using muc::pow;
 
     // Adapt from McMule v0.5.1, mudec/mudec_pm2ennggav.f95
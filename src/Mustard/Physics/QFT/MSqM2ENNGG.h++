@@ -21,6 +21,9 @@
 #include "Mustard/Physics/QFT/PolarizedMatrixElement.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 
+#include <cstddef>
+#include <span>
+
 namespace Mustard::inline Physics::QFT {
 
 /// @class MSqM2ENNGG
@@ -41,16 +44,27 @@ public:
     ///
     /// @note Implementation based on McMule's analytical expressions
     virtual auto operator()(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double override;
+    /// @brief Calculate squared matrix element for a batch of phase space points.
+    /// Kernels are evaluated for several points at once, see `MatrixElement::Batch`
+    virtual auto Batch(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void override;
+
+private:
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto Unpolarized(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                  T den1, T den2, T den3, T den4, T den5, T den6) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto PolarizedS2n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                   T den1, T den2, T den3, T den4, T den5, T den6) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto PolarizedS5n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                   T den1, T den2, T den3, T den4, T den5, T den6) -> T;
+    template<typename T>
+    MUSTARD_OPTIMIZE_FAST static auto PolarizedS6n(T mm2, T me2, T s12, T s15, T s16, T s25, T s26, T s56,
+                                                   T den1, T den2, T den3, T den4, T den5, T den6) -> T;
 
 private:
-    MUSTARD_OPTIMIZE_FAST static auto Unpolarized(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                  double den1, double den2, double den3, double den4, double den5, double den6) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto PolarizedS2n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                   double den1, double den2, double den3, double den4, double den5, double den6) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto PolarizedS5n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                   double den1, double den2, double den3, double den4, double den5, double den6) -> double;
-    MUSTARD_OPTIMIZE_FAST static auto PolarizedS6n(double mm2, double me2, double s12, double s15, double s16, double s25, double s26, double s56,
-                                                   double den1, double den2, double den3, double den4, double den5, double den6) -> double;
+    /// @brief Number of phase space points evaluated at once by `Batch`
+    static constexpr std::size_t fgBatchWidth{4};
 };
 
 } // namespace Mustard::inline Physics::QFT
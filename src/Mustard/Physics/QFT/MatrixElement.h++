@@ -20,7 +20,12 @@
 
 #include "Mustard/Math/Vector.h++"
 
+#include "gsl/gsl"
+
+#include <algorithm>
 #include <array>
+#include <span>
+#include <string>
 #include <type_traits>
 
 namespace Mustard::inline Physics::QFT {
@@ -51,6 +56,19 @@ public:
     /// @param pF Final-state 4-momenta
     /// @return |M|² value
     virtual auto operator()(const InitialStateMomenta& pI, const FinalStateMomenta& pF) const -> double = 0;
+    /// @brief Calculate squared matrix element |M|² for a batch of phase space points
+    /// @param pI Initial-state 4-momenta (shared by all points)
+    /// @param pF Final-state 4-momenta of each point
+    /// @param mSq Output |M|² of each point (same size as pF)
+    /// @note The default implementation evaluates point by point. Matrix elements
+    /// with heavy kernels override it to evaluate several points at once.
+    virtual auto Batch(const InitialStateMomenta& pI, std::span<const FinalStateMomenta> pF, std::span<double> mSq) const -> void {
+        Expects(pF.size() == mSq.size());
+        std::ranges::transform(pF, mSq.begin(), [&](const FinalStateMomenta& p) { return (*this)(pI, p); });
+    }
+    /// @brief Get a string identifying runtime options that change |M|² (e.g. version)
+    /// @note Empty by default. Matrix elements with such options override it
+    virtual auto Signature() const -> std::string { return {}; }
 };
 
 } // namespace Mustard::inline Physics::QFT
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "muc/math"
+
+#include <array>
+#include <cstddef>
+
+namespace Mustard::inline Physics::QFT::internal {
+
+/// @brief W doubles with lane-wise arithmetic, used to instantiate scalar
+/// matrix element kernels for W phase space points at once. Lane-wise loops
+/// are simple enough for the compiler to emit SIMD instructions.
+/// @note Implicitly converts from double (broadcast), so kernels written for
+/// double (e.g. `2 * x`, `pow(x, 3)`) compile unchanged.
+template<std::size_t W>
+struct DoublePack {
+    std::array<double, W> lane;
+
+    DoublePack() = default;
+    constexpr DoublePack(double x) { lane.fill(x); }
+
+    constexpr auto operator[](std::size_t i) const -> double { return lane[i]; }
+    constexpr auto operator[](std::size_t i) -> double& { return lane[i]; }
+
+    constexpr auto operator-() const -> DoublePack {
+        DoublePack r;
+        for (std::size_t i{}; i < W; ++i) { r.lane[i] = -lane[i]; }
+        return r;
+    }
+
+    constexpr auto operator+=(const DoublePack& b) -> DoublePack& {
+        for (std::size_t i{}; i < W; ++i) { lane[i] += b.lane[i]; }
+        return *this;
+    }
+    constexpr auto operator-=(const DoublePack& b) -> DoublePack& {
+        for (std::size_t i{}; i < W; ++i) { lane[i] -= b.lane[i]; }
+        return *this;
+    }
+    constexpr auto operator*=(const DoublePack& b) -> DoublePack& {
+        for (std::size_t i{}; i < W; ++i) { lane[i] *= b.lane[i]; }
+        return *this;
+    }
+    constexpr auto operator/=(const DoublePack& b) -> DoublePack& {
+        for (std::size_t i{}; i < W; ++i) { lane[i] /= b.lane[i]; }
+        return *this;
+    }
+
+    friend constexpr auto operator+(DoublePack a, const DoublePack& b) -> DoublePack { return a += b; }
+    friend constexpr auto operator-(DoublePack a, const DoublePack& b) -> DoublePack { return a -= b; }
+    friend constexpr auto operator*(DoublePack a, const DoublePack& b) -> DoublePack { return a *= b; }
+    friend constexpr auto operator/(DoublePack a, const DoublePack& b) -> DoublePack { return a /= b; }
+
+    /// @brief Lane-wise integer power, found by ADL in kernels `using muc::pow`
+    friend constexpr auto pow(DoublePack x, int n) -> DoublePack {
+        for (std::size_t i{}; i < W; ++i) { x.lane[i] = muc::pow(x.lane[i], n); }
+        return x;
+    }
+};
+
+} // namespace Mustard::inline Physics::QFT::internal
@@ -5,6 +5,7 @@
 #include "Mustard/Geant4X/Utility/ConvertGeometry.h++"
 #include "Mustard/IO/File.h++"
 #include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/MergeProcessSpecificFile.h++"
 #include "Mustard/Simulation/AnalysisBaseMessenger.h++"
 
 #include "TMacro.h"
@@ -19,6 +20,7 @@
 #include <filesystem>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace Mustard::Simulation {
@@ -31,6 +33,9 @@ public:
 
     auto FilePath(std::filesystem::path path) -> void { fFilePath = std::move(path); }
     auto FileMode(std::string mode) -> void { fFileMode = std::move(mode); }
+    /// @brief Merge process-specific files at the end of each run (see
+    /// Mustard::Parallel::MergeProcessSpecificFile), or not if std::nullopt (default).
+    auto MergeFile(std::optional<Parallel::MergeLevel> level) -> void { fMergeFile = level; }
 
     auto RunBeginAction(int runID) -> void;
     auto EventEndAction() -> void;
@@ -44,8 +49,10 @@ private:
 private:
     std::filesystem::path fFilePath;
     std::string fFileMode;
+    std::optional<Parallel::MergeLevel> fMergeFile;
 
     std::filesystem::path fLastUsedFullFilePath;
+    std::string fCurrentFileMode;
     std::optional<ProcessSpecificFile<TFile>> fFile;
 
     AnalysisBaseMessenger<ADerived>::template Register<ADerived> fMessengerRegister;
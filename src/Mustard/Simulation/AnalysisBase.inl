@@ -5,7 +5,9 @@ AnalysisBase<ADerived, AAppName>::AnalysisBase(ADerived* self) :
     Env::Memory::PassiveSingleton<ADerived>{self},
     fFilePath{fmt::format("{}_untitled", AAppName.sv())},
     fFileMode{"NEW"},
+    fMergeFile{},
     fLastUsedFullFilePath{},
+    fCurrentFileMode{},
     fFile{},
     fMessengerRegister{self} {
     static_assert(std::derived_from<ADerived, AnalysisBase<ADerived, AAppName>>);
@@ -15,7 +17,8 @@ template<typename ADerived, muc::ceta_string AAppName>
 auto AnalysisBase<ADerived, AAppName>::RunBeginAction(int runID) -> void {
     // open ROOT file
     const auto filePathChanged{fFilePath != fLastUsedFullFilePath};
-    fFile.emplace(fFilePath, filePathChanged ? fFileMode : "UPDATE");
+    fCurrentFileMode = filePathChanged ? fFileMode : "UPDATE";
+    fFile.emplace(fFilePath, fCurrentFileMode);
     fLastUsedFullFilePath = fFilePath;
     // save geometry
     if (filePathChanged and mplr::comm_world().rank() == 0) {
@@ -37,6 +40,10 @@ auto AnalysisBase<ADerived, AAppName>::RunEndAction(int runID) -> void {
     RunEndUserAction(runID);
     // close file
     fFile.reset();
+    // merge process-specific files
+    if (fMergeFile) {
+        Parallel::MergeProcessSpecificFile(fFilePath, *fMergeFile, fCurrentFileMode);
+    }
 }
 
 } // namespace Mustard::Simulation
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Mustard/Geant4X/Interface/SingletonMessenger.h++"
+#include "Mustard/Parallel/MergeProcessSpecificFile.h++"
 
 #include "G4UIcmdWithAString.hh"
 #include "G4UIdirectory.hh"
@@ -9,6 +10,7 @@
 
 #include <concepts>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 namespace Mustard::Simulation {
@@ -29,6 +31,7 @@ private:
     std::unique_ptr<G4UIdirectory> fDirectory;
     std::unique_ptr<G4UIcmdWithAString> fFilePath;
     std::unique_ptr<G4UIcmdWithAString> fFileMode;
+    std::unique_ptr<G4UIcmdWithAString> fMergeFile;
 };
 
 } // namespace Mustard::Simulation
@@ -5,7 +5,8 @@ AnalysisBaseMessenger<AReceiver>::AnalysisBaseMessenger() :
     Geant4X::SingletonMessenger<AnalysisBaseMessenger<AReceiver>, AReceiver>{},
     fDirectory{},
     fFilePath{},
-    fFileMode{} {
+    fFileMode{},
+    fMergeFile{} {
 
     fDirectory = std::make_unique<G4UIdirectory>("/Mustard/Analysis/");
     fDirectory->SetGuidance("Simulation analysis controller.");
@@ -19,6 +20,12 @@ AnalysisBaseMessenger<AReceiver>::AnalysisBaseMessenger() :
     fFileMode->SetGuidance("Set mode (NEW, RECREATE, or UPDATE) for opening ROOT file(s).");
     fFileMode->SetParameterName("mode", false);
     fFileMode->AvailableForStates(G4State_Idle);
+
+    fMergeFile = std::make_unique<G4UIcmdWithAString>("/Mustard/Analysis/MergeFile", this);
+    fMergeFile->SetGuidance("Merge process-specific ROOT files at the end of run, into one file per node (node), one file for all processes (job), or do not merge (none).");
+    fMergeFile->SetParameterName("level", false);
+    fMergeFile->SetCandidates("none node job");
+    fMergeFile->AvailableForStates(G4State_Idle);
 }
 
 template<typename AReceiver>
@@ -31,6 +38,16 @@ auto AnalysisBaseMessenger<AReceiver>::SetNewValue(G4UIcommand* command, G4Strin
         this->template Deliver<AReceiver>([&](auto&& r) {
             r.FileMode(value);
         });
+    } else if (command == fMergeFile.get()) {
+        this->template Deliver<AReceiver>([&](auto&& r) {
+            if (value == "node") {
+                r.MergeFile(Parallel::MergeLevel::Node);
+            } else if (value == "job") {
+                r.MergeFile(Parallel::MergeLevel::Job);
+            } else {
+                r.MergeFile(std::nullopt);
+            }
+        });
     }
 }
 
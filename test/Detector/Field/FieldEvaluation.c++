@@ -0,0 +1,188 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "FieldMapFixture.h++"
+
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Detector/Field/MagneticFieldMap.h++"
+#include "Mustard/Detector/Field/ToroidField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/CreateTemporaryFile.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+
+#include "CLHEP/Units/PhysicalConstants.h"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+#include "muc/chrono"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+using namespace Mustard;
+using namespace Mustard::Detector::Field;
+
+namespace {
+
+constexpr auto halfLength{500.};
+constexpr std::size_t nPoint{1'000'000};
+
+/// Smooth electromagnetic field.
+auto SmoothField(double x, double y, double z) -> std::array<double, 6> {
+    const auto u{x / halfLength};
+    const auto v{y / halfLength};
+    const auto w{z / halfLength};
+    return {0.1 * u * w,
+            0.1 * v * w,
+            1 - 0.05 * (u * u + v * v) + 0.1 * w * w,
+            1e5 * u,
+            1e5 * v,
+            0};
+}
+
+/// Points uniformly distributed in the field map.
+auto RandomPoint(Random::Xoshiro256PlusPlus& random) -> std::vector<muc::array3d> {
+    std::uniform_real_distribution<double> uniform{-halfLength, halfLength};
+    std::vector<muc::array3d> point(nPoint);
+    for (auto&& x : point) {
+        x = {uniform(random), uniform(random), uniform(random)};
+    }
+    return point;
+}
+
+/// Points along helical tracks with 1 mm steps, as queried by a stepper.
+auto TrackPoint(Random::Xoshiro256PlusPlus& random) -> std::vector<muc::array3d> {
+    std::uniform_real_distribution<double> uniform{-0.5 * halfLength, 0.5 * halfLength};
+    std::uniform_real_distribution<double> angle{0, CLHEP::twopi};
+    std::vector<muc::array3d> point;
+    point.reserve(nPoint);
+    while (point.size() < nPoint) {
+        const muc::array3d x0{uniform(random), uniform(random), -halfLength};
+        const auto radius{0.2 * halfLength + 0.1 * uniform(random)};
+        const auto phi0{angle(random)};
+        for (auto s{0.}; point.size() < nPoint; s += 1) {
+            const auto phi{phi0 + s / (2 * radius)};
+            const muc::array3d x{x0[0] + radius * std::cos(phi), x0[1] + radius * std::sin(phi), x0[2] + s / 2};
+            if (x[2] > halfLength) { break; }
+            point.push_back(x);
+        }
+    }
+    return point;
+}
+
+template<typename AEvaluate>
+auto Benchmark(std::string_view name, std::string_view pattern, const std::vector<muc::array3d>& point, AEvaluate&& Evaluate) -> void {
+    auto sum{0.};
+    for (std::size_t i{}; i < point.size() / 10; ++i) {
+        sum += Evaluate(point[i]);
+    }
+    muc::chrono::stopwatch stopwatch;
+    for (auto&& x : point) {
+        sum += Evaluate(x);
+    }
+    const muc::chrono::nanoseconds<double> time{stopwatch.read()};
+    std::cout << std::setw(48) << name << std::setw(8) << pattern << " : "
+              << std::setw(8) << time.count() / point.size() << " ns/eval (checksum: " << sum << ')' << std::endl;
+}
+
+template<typename AField>
+auto BenchmarkB(std::string_view name, const AField& field,
+                const std::vector<muc::array3d>& random, const std::vector<muc::array3d>& track) -> void {
+    const auto Evaluate{[&](const muc::array3d& x) { return field.B(x)[2]; }};
+    Benchmark(name, "random", random, Evaluate);
+    Benchmark(name, "track", track, Evaluate);
+}
+
+template<typename AField>
+auto BenchmarkBE(std::string_view name, const AField& field,
+                 const std::vector<muc::array3d>& random, const std::vector<muc::array3d>& track) -> void {
+    const auto Evaluate{[&](const muc::array3d& x) {
+        const auto [b, e]{field.BE(x)};
+        return b[2] + e[0];
+    }};
+    Benchmark(name, "random", random, Evaluate);
+    Benchmark(name, "track", track, Evaluate);
+}
+
+template<typename AField>
+auto BenchmarkG4(std::string_view name, const AField& field,
+                 const std::vector<muc::array3d>& random, const std::vector<muc::array3d>& track) -> void {
+    const auto Evaluate{[&](const muc::array3d& x) {
+        const double x4[4]{x[0], x[1], x[2], 0};
+        double f[6]{};
+        field.GetFieldValue(x4, f);
+        return f[2] + f[3];
+    }};
+    Benchmark(name, "random", random, Evaluate);
+    Benchmark(name, "track", track, Evaluate);
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    Env::MPIEnv env{argc, argv, {}};
+
+    // symmetric maps fold coordinates into the map, so the full map serves them as well
+    const auto mapPath{CreateTemporaryFile("FieldEvaluation", ".root")};
+    Test::WriteFieldMap<6>(mapPath, 51, halfLength, {"Bx", "By", "Bz", "Ex", "Ey", "Ez"}, SmoothField);
+
+    Random::Xoshiro256PlusPlus random;
+    const auto randomPoint{RandomPoint(random)};
+    const auto trackPoint{TrackPoint(random)};
+
+    std::cout << "Analytic fields:" << std::endl;
+    BenchmarkB("UniformMagneticField", UniformMagneticField{0, 0, 1}, randomPoint, trackPoint);
+    BenchmarkB("ToroidField", ToroidField{1, halfLength, Eigen::Vector3d{0, 0, 0}, Eigen::Vector3d{0, 0, 1}}, randomPoint, trackPoint);
+
+    std::cout << "Magnetic field maps:" << std::endl;
+    BenchmarkB("MagneticFieldMap<>", MagneticFieldMap<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryX<>", MagneticFieldMapSymmetryX<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryY<>", MagneticFieldMapSymmetryY<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryZ<>", MagneticFieldMapSymmetryZ<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryXY<>", MagneticFieldMapSymmetryXY<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryXZ<>", MagneticFieldMapSymmetryXZ<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryYZ<>", MagneticFieldMapSymmetryYZ<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapSymmetryXYZ<>", MagneticFieldMapSymmetryXYZ<>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("SharedMagneticFieldMap<Double>", SharedMagneticFieldMap<Eigen::Vector3d, "Double">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("SharedMagneticFieldMap<Float>", SharedMagneticFieldMap<Eigen::Vector3d, "Float">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("SharedMagneticFieldMap<Quantized>", SharedMagneticFieldMap<Eigen::Vector3d, "Quantized">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkB("MagneticFieldMapOctree<>", MagneticFieldMapOctree<>{mapPath, "FieldMap", 1e-4}, randomPoint, trackPoint);
+
+    std::cout << "Electromagnetic field maps:" << std::endl;
+    BenchmarkBE("ElectromagneticFieldMap<WithCache>", ElectromagneticFieldMap<"WithCache">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkBE("ElectromagneticFieldMap<NoCache>", ElectromagneticFieldMap<"NoCache">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkBE("SharedElectromagneticFieldMap<WithCache>", SharedElectromagneticFieldMap<"WithCache">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkBE("SharedElectromagneticFieldMap<NoCache>", SharedElectromagneticFieldMap<"NoCache">{mapPath, "FieldMap"}, randomPoint, trackPoint);
+
+    std::cout << "Geant4 interface:" << std::endl;
+    BenchmarkG4("AsG4Field<UniformMagneticField>", AsG4Field<UniformMagneticField>{0, 0, 1}, randomPoint, trackPoint);
+    BenchmarkG4("AsG4Field<MagneticFieldMap<>>", AsG4Field<MagneticFieldMap<>>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+    BenchmarkG4("AsG4Field<ElectromagneticFieldMap<WithCache>>", AsG4Field<ElectromagneticFieldMap<"WithCache">>{mapPath, "FieldMap"}, randomPoint, trackPoint);
+
+    Test::RemoveFieldMap(mapPath);
+
+    return EXIT_SUCCESS;
+}
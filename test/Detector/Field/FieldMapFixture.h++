@@ -0,0 +1,76 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/IO/File.h++"
+
+#include "TFile.h"
+#include "TTree.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Mustard::Test {
+
+/// Write a field map on a uniform n^3 grid over [-halfLength, halfLength]^3
+/// to tree "FieldMap", with columns x, y, z followed by valueName.
+/// Field(x, y, z) returns the N values at a grid point.
+template<std::size_t N>
+auto WriteFieldMap(const std::filesystem::path& path, int n, double halfLength,
+                   const std::array<std::string_view, N>& valueName,
+                   std::invocable<double, double, double> auto&& Field) -> void {
+    File<TFile> file{path, "RECREATE"};
+    const auto tree{new TTree{"FieldMap", "FieldMap"}};
+    std::array<double, 3> x;
+    std::array<double, N> value;
+    tree->Branch("x", &x[0]);
+    tree->Branch("y", &x[1]);
+    tree->Branch("z", &x[2]);
+    for (std::size_t i{}; i < N; ++i) {
+        tree->Branch(std::string{valueName[i]}.c_str(), &value[i]);
+    }
+    const auto delta{2 * halfLength / (n - 1)};
+    for (int i{}; i < n; ++i) {
+        for (int j{}; j < n; ++j) {
+            for (int k{}; k < n; ++k) {
+                x = {-halfLength + i * delta, -halfLength + j * delta, -halfLength + k * delta};
+                value = Field(x[0], x[1], x[2]);
+                tree->Fill();
+            }
+        }
+    }
+    tree->Write();
+}
+
+/// Remove a field map written by WriteFieldMap, and the field map caches
+/// created next to it (one per map signature).
+inline auto RemoveFieldMap(const std::filesystem::path& path) -> void {
+    const auto cachePrefix{path.filename().string() + ".FieldMap."};
+    for (auto&& entry : std::filesystem::directory_iterator{path.parent_path()}) {
+        if (const auto name{entry.path().filename().string()};
+            name.starts_with(cachePrefix) and name.ends_with(".fieldmap")) {
+            std::filesystem::remove(entry.path());
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+} // namespace Mustard::Test
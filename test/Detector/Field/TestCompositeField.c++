@@ -0,0 +1,100 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Detector/Field/AsG4Field.h++"
+#include "Mustard/Detector/Field/CompositeField.h++"
+#include "Mustard/Detector/Field/UniformElectricField.h++"
+#include "Mustard/Detector/Field/UniformMagneticField.h++"
+
+#include "muc/array"
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+using namespace Mustard::Detector::Field;
+
+namespace {
+
+struct TestPoint {
+    muc::array3d x;
+    muc::array3d b;
+    muc::array3d e;
+};
+
+auto failed{false};
+
+auto Check(std::string_view what, const muc::array3d& x, const muc::array3d& value, const muc::array3d& expected) -> void {
+    for (int i{}; i < 3; ++i) {
+        if (std::abs(value[i] - expected[i]) > 1e-12) {
+            std::cerr << what << " at (" << x[0] << ", " << x[1] << ", " << x[2] << "): got ("
+                      << value[0] << ", " << value[1] << ", " << value[2] << "), expected ("
+                      << expected[0] << ", " << expected[1] << ", " << expected[2] << ')' << std::endl;
+            failed = true;
+            return;
+        }
+    }
+}
+
+} // namespace
+
+auto main() -> int {
+    // unbounded Bz, Bx inside [-1, 1]^3, Ey inside [0, 2]^3
+    const FieldSupport box1{{-1, -1, -1}, {1, 1, 1}};
+    const FieldSupport box2{{0, 0, 0}, {2, 2, 2}};
+    const CompositeField<UniformMagneticField, UniformMagneticField, UniformElectricField> field{
+        {std::make_unique<UniformMagneticField>(0, 0, 1)},
+        {std::make_unique<UniformMagneticField>(1, 0, 0), box1},
+        {std::make_unique<UniformElectricField>(0, 2, 0), box2}};
+
+    constexpr auto nan{std::numeric_limits<double>::quiet_NaN()};
+    const std::array<TestPoint, 6> testPoint{{
+        {{0.5, 0.5, 0.5}, {1, 0, 1}, {0, 2, 0}},    // inside both boxes
+        {{-0.5, -0.5, -0.5}, {1, 0, 1}, {0, 0, 0}}, // inside box1 only
+        {{1.5, 1.5, 1.5}, {0, 0, 1}, {0, 2, 0}},    // inside box2 only
+        {{1.5, -0.5, 0.5}, {0, 0, 1}, {0, 0, 0}},   // inside the index, outside both boxes
+        {{5, 5, 5}, {0, 0, 1}, {0, 0, 0}},          // outside the index
+        {{nan, 0.5, 0.5}, {0, 0, 1}, {0, 0, 0}}}};  // only unbounded fields at NaN
+    for (auto&& [x, b, e] : testPoint) {
+        Check("B", x, field.B(x), b);
+        Check("E", x, field.E(x), e);
+        const auto [fB, fE]{field.BE(x)};
+        Check("BE (B)", x, fB, b);
+        Check("BE (E)", x, fE, e);
+    }
+
+    // Geant4 interface of a magnetic composite field
+    const AsG4Field<CompositeField<UniformMagneticField, UniformMagneticField>> g4Field{
+        CompositeFieldComponent<UniformMagneticField>{std::make_unique<UniformMagneticField>(0, 0, 1)},
+        CompositeFieldComponent<UniformMagneticField>{std::make_unique<UniformMagneticField>(1, 0, 0), box1}};
+    for (auto&& [x, b, e] : std::array<TestPoint, 2>{{{{0.5, 0.5, 0.5}, {1, 0, 1}, {0, 0, 0}},
+                                                       {{5, 5, 5}, {0, 0, 1}, {0, 0, 0}}}}) {
+        std::array<G4double, 6> f;
+        g4Field.GetFieldValue(x.data(), f.data());
+        Check("AsG4Field (B)", x, {f[0], f[1], f[2]}, b);
+        Check("AsG4Field (E)", x, {f[3], f[4], f[5]}, e);
+    }
+
+    if (failed) {
+        return EXIT_FAILURE;
+    }
+    std::cout << "CompositeField OK" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "FieldMapFixture.h++"
+
+#include "Mustard/Detector/Field/GridFieldMap3D.h++"
+#include "Mustard/Detector/Field/OctreeFieldMap3D.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/CreateTemporaryFile.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+
+#include "Eigen/Core"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+using namespace Mustard;
+using namespace Mustard::Detector::Field;
+
+namespace {
+
+constexpr auto halfLength{500.};
+
+/// Smooth field except for a steep step across x = 100,
+/// so that the octree has both large and small leaves.
+auto SteppedField(double x, double y, double z) -> std::array<double, 3> {
+    const auto u{x / halfLength};
+    const auto v{y / halfLength};
+    const auto w{z / halfLength};
+    return {0.1 * u * w,
+            0.1 * v * w,
+            1 - 0.05 * (u * u + v * v) + 0.1 * w * w + 0.5 * std::tanh((x - 100) / 20)};
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    Env::MPIEnv env{argc, argv, {}};
+
+    const auto mapPath{CreateTemporaryFile("TestOctreeFieldMap", ".root")};
+    Test::WriteFieldMap<3>(mapPath, 41, halfLength, {"Bx", "By", "Bz"}, SteppedField);
+
+    auto failed{false};
+    {
+        const GridFieldMap3D<Eigen::Vector3d> grid{mapPath, "FieldMap"};
+        for (auto tolerance : {1e-2, 1e-3, 1e-4}) {
+            const OctreeFieldMap3D<Eigen::Vector3d> octree{grid, tolerance};
+            std::cout << "Tolerance " << tolerance << ": " << octree.NNode() << " nodes, " << octree.NLeaf() << " leaves, "
+                      << octree.NVertex() << " vertices, depth " << octree.Depth() << std::endl;
+            // corners are shared between leaves
+            if (octree.NVertex() >= 8 * octree.NLeaf() and octree.NLeaf() > 1) {
+                std::cerr << "Leaf corners are not shared" << std::endl;
+                failed = true;
+            }
+
+            // the leaf interpolant deviates from the grid interpolant by at most the
+            // deviation at grid points, so the bound holds at grid points and between them
+            const auto MaxDeviation{[&](double x, double y, double z) {
+                const auto f{octree(x, y, z)};
+                const auto g{grid(x, y, z)};
+                return (f - g).cwiseAbs().maxCoeff();
+            }};
+            auto maxDeviation{0.};
+            const auto& [min, delta, n]{grid.Grid()};
+            for (int i{}; i < n[0]; ++i) {
+                for (int j{}; j < n[1]; ++j) {
+                    for (int k{}; k < n[2]; ++k) {
+                        maxDeviation = std::max(maxDeviation, MaxDeviation(min[0] + i * delta[0], min[1] + j * delta[1], min[2] + k * delta[2]));
+                    }
+                }
+            }
+            Random::Xoshiro256PlusPlus random;
+            std::uniform_real_distribution<double> uniform{-halfLength, halfLength};
+            for (int i{}; i < 100'000; ++i) {
+                maxDeviation = std::max(maxDeviation, MaxDeviation(uniform(random), uniform(random), uniform(random)));
+            }
+            std::cout << "  max deviation from grid: " << maxDeviation << std::endl;
+            // allow for rounding in locating points
+            if (not(maxDeviation <= tolerance * (1 + 1e-9) + 1e-12)) {
+                std::cerr << "Max deviation " << maxDeviation << " exceeds tolerance " << tolerance << std::endl;
+                failed = true;
+            }
+        }
+    }
+
+    Test::RemoveFieldMap(mapPath);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}